@@ -34,6 +34,7 @@ struct FakeHeapList
     DWORD_PTR           endAddress;     // changed from PBYTE
     DWORD_PTR           mapBase;        // changed from PBYTE
     DWORD_PTR           pHdrMap;        // changed from DWORD*
+    DWORD_PTR           pSkipMap;       // changed from DWORD*
     size_t              maxCodeHeapSize;
     size_t              reserveForJumpStubs;
     DWORD_PTR           pLoaderAllocator;
@@ -124,6 +125,7 @@ class CheckDuplicatedStructLayouts
     CHECK_OFFSET(HeapList, endAddress);
     CHECK_OFFSET(HeapList, mapBase);
     CHECK_OFFSET(HeapList, pHdrMap);
+    CHECK_OFFSET(HeapList, pSkipMap);
 
 #if !defined(TARGET_X86)
     CHECK_OFFSET(RealCodeHeader,    nUnwindInfos);
@@ -351,6 +351,7 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_JitELTHookEnabled, W("JitELTHookEnabled"), 0,
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_JitMemStats, W("JitMemStats"), 0, "Display JIT memory usage statistics")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_JitVNMapSelBudget, W("JitVNMapSelBudget"), 100, "Max # of MapSelect's considered for a particular top-level invocation.")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TrackDynamicMethodDebugInfo, W("TrackDynamicMethodDebugInfo"), 0, "Specifies whether debug info should be generated and tracked for dynamic methods")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_GenericLookupStats, W("GenericLookupStats"), 0, "If set, count slow-path generic dictionary lookups and dictionary expansions per method or type. Counts are only reported through the stress log, so it must be enabled as well.")
 
 #ifdef FEATURE_MULTICOREJIT
 
@@ -592,6 +593,7 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_DeleteCallCountingStubsAfter, W("TC_DeleteC
 #ifdef FEATURE_ON_STACK_REPLACEMENT
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_OSR_CounterBump, W("OSR_CounterBump"), 1000, "Counter reload value when a patchpoint is hit")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_OSR_HitLimit, W("OSR_HitLimit"), 10, "Number of times a patchpoint must call back to trigger an OSR transition")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_OSR_AwaitCounterBump, W("OSR_AwaitCounterBump"), 0, "Counter reload value while another thread is creating the OSR method for a patchpoint. 0 (default) uses OSR_CounterBump.")
 CONFIG_DWORD_INFO(INTERNAL_OSR_LowId, W("OSR_LowId"), (DWORD)-1, "Low end of enabled patchpoint range (inclusive)");
 CONFIG_DWORD_INFO(INTERNAL_OSR_HighId, W("OSR_HighId"), 10000000, "High end of enabled patchpoint range (inclusive)");
 #endif
@@ -628,6 +630,7 @@ RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_BackpatchEntryPointSlots, W("BackpatchEntry
 /// TypeLoader
 ///
 CONFIG_DWORD_INFO(INTERNAL_TypeLoader_InjectInterfaceDuplicates, W("INTERNAL_TypeLoader_InjectInterfaceDuplicates"), 0, "Injects duplicates in interface map for all types.")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_TypeCreationStats, W("TypeCreationStats"), 0, "If set, measure the exclusive time and loader heap memory of each type load and report them with the TypeCreationStats event (TypeDiagnostic keyword).")
 
 ///
 /// Virtual call stubs
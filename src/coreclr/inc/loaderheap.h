@@ -1087,6 +1087,9 @@ class AllocMemTracker
 
         void SuppressRelease();
 
+        // Returns the total number of bytes requested by the blocks tracked so far.
+        size_t GetTrackedBytes();
+
     private:
         struct AllocMemTrackerNode
         {
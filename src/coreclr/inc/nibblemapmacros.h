@@ -23,6 +23,13 @@
 // In order to speed up "backwards scanning" we start numbering
 // nibbles inside a DWORD from the highest bits (28..31). Because
 // of that we can scan backwards inside the DWORD with right shifts.
+//
+// The backwards scan is linear in the distance to the method start, which
+// is slow for large methods. To bound it, a second map (the skip map) keeps
+// one DWORD per 4k block of the code heap. If a method starts before a block
+// and extends into it, the block's entry holds the offset of that method's
+// start (plus one, so that zero means "no entry"). A lookup then never scans
+// the nibble map past the beginning of the block that contains the address.
 
 #if defined(HOST_64BIT)
 // TODO: bump up the windows CODE_ALIGN to 16 and iron out any nibble map bugs that exist.
@@ -51,4 +58,15 @@
 #define POS2SHIFTCOUNT(x)       (DWORD)  (HIGHEST_NIBBLE_BIT - (((x) & NIBBLES_PER_DWORD_MASK) << LOG2_NIBBLE_SIZE))
 #define POS2MASK(x)             (DWORD) ~(HIGHEST_NIBBLE_MASK >> (((x) & NIBBLES_PER_DWORD_MASK) << LOG2_NIBBLE_SIZE))
 
+#define LOG2_BYTES_PER_SKIP_ENTRY   12                                       // 4k bytes per skip map entry
+#define BYTES_PER_SKIP_ENTRY        (1 << LOG2_BYTES_PER_SKIP_ENTRY)
+#define LOG2_DWORDS_PER_SKIP_ENTRY  (LOG2_BYTES_PER_SKIP_ENTRY - LOG2_BYTES_PER_BUCKET - LOG2_NIBBLES_PER_DWORD) // 16 nibble map DWORDs per entry
+
+#define ADDR2SKIPPOS(x)                  ((x) >> LOG2_BYTES_PER_SKIP_ENTRY)
+#define SKIPPOS2ADDR(pos)       (size_t) ((size_t)(pos) << LOG2_BYTES_PER_SKIP_ENTRY)
+#define ADDR2SKIPENTRY(x)       (DWORD)  ((x) + 1)
+#define SKIPENTRY2ADDR(e)       (size_t) ((e) - 1)
+#define MAX_SKIPENTRY_ADDR               ((size_t)0xFFFFFFFE)
+#define HEAP2SKIPMAPSIZE(x)              (((x) >> LOG2_BYTES_PER_SKIP_ENTRY) * sizeof(DWORD))
+
 #endif  // NIBBLEMAPMACROS_H_
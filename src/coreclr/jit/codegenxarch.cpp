@@ -10841,7 +10841,18 @@ void CodeGen::genZeroInitFrameUsingBlockInit(int untrLclHi, int untrLclLo, regNu
                     emit->emitIns_AR_R(simdUnalignedMovIns(), EA_ATTR(maxSimdSize), zeroSIMDReg, frameReg,
                                        alignedLclLo + i);
                 }
-                // Remainder will be handled by the xmm loop below
+
+                // Cover a remainder of more than one xmm with a single store overlapping
+                // the previously zeroed data rather than with a sequence of xmm stores.
+                if ((blkSize - i) > XMM_REGSIZE_BYTES)
+                {
+                    int regSize = (int)compiler->roundUpSIMDSize(blkSize - i);
+                    assert(regSize <= maxSimdSize);
+                    emit->emitIns_AR_R(simdUnalignedMovIns(), EA_ATTR(regSize), zeroSIMDReg, frameReg,
+                                       alignedLclLo + blkSize - regSize);
+                    i = blkSize;
+                }
+                // Otherwise the remainder will be handled by the xmm loop below
             }
 
             for (; i < blkSize; i += XMM_REGSIZE_BYTES)
@@ -10853,59 +10864,57 @@ void CodeGen::genZeroInitFrameUsingBlockInit(int untrLclHi, int untrLclLo, regNu
         }
         else
         {
-            // Generate the following code:
+            // Generate the following code (with the widest available vector, e.g. ymm4 with AVX):
             //
             //    xorps    xmm4, xmm4
-            //    ;movaps xmmword ptr[ebp/esp-loOFFS], xmm4          ; alignment to 3x
-            //    ;movaps xmmword ptr[ebp/esp-loOFFS + 10H], xmm4    ;
+            //    ;movups xmmword ptr[ebp/esp-loOFFS], xmm4          ; alignment to 3x
+            //    ;movups xmmword ptr[ebp/esp-loOFFS + 10H], xmm4    ;
             //    mov rax, - <size>                                  ; start offset from hi
             //    movaps xmmword ptr[rbp + rax + hiOFFS      ], xmm4 ; <--+
             //    movaps xmmword ptr[rbp + rax + hiOFFS + 10H], xmm4 ;    |
             //    movaps xmmword ptr[rbp + rax + hiOFFS + 20H], xmm4 ;    | Loop
             //    add rax, 48                                        ;    |
             //    jne SHORT  -5 instr                                ; ---+
+            //
+            // NOTE: xorps implicitly zeroes YMM4 and ZMM4 as well.
 
             emit->emitIns_SIMD_R_R_R(INS_xorps, EA_16BYTE, zeroSIMDReg, zeroSIMDReg, zeroSIMDReg, INS_OPTS_NONE);
 
-            // How many extra don't fit into the 3x unroll
-            int extraSimd = (blkSize % (XMM_REGSIZE_BYTES * 3)) / XMM_REGSIZE_BYTES;
-            if (extraSimd != 0)
+            // The data is only known to be aligned to 16 bytes, so wider stores are unaligned.
+            const int         simdSize    = maxSimdSize;
+            const instruction loopSimdMov = (simdSize == XMM_REGSIZE_BYTES) ? simdMov : simdUnalignedMovIns();
+
+            // Whatever doesn't fit into the 3x unroll is zeroed at the low end of the block, the
+            // last of these stores possibly overlapping the area zeroed by the loop.
+            int extraSize = blkSize % (simdSize * 3);
+            for (int i = 0; i < extraSize; i += simdSize)
             {
-                blkSize -= XMM_REGSIZE_BYTES;
-                // Not a multiple of 3 so add stores at low end of block
-                emit->emitIns_AR_R(simdMov, EA_ATTR(XMM_REGSIZE_BYTES), zeroSIMDReg, frameReg, alignedLclLo);
-                if (extraSimd == 2)
-                {
-                    blkSize -= XMM_REGSIZE_BYTES;
-                    // one more store needed
-                    emit->emitIns_AR_R(simdMov, EA_ATTR(XMM_REGSIZE_BYTES), zeroSIMDReg, frameReg,
-                                       alignedLclLo + XMM_REGSIZE_BYTES);
-                }
+                emit->emitIns_AR_R(loopSimdMov, EA_ATTR(simdSize), zeroSIMDReg, frameReg, alignedLclLo + i);
             }
+            blkSize -= extraSize;
 
             // Exact multiple of 3 simd lengths (or loop end condition will not be met)
-            noway_assert((blkSize % (3 * XMM_REGSIZE_BYTES)) == 0);
+            noway_assert((blkSize % (3 * simdSize)) == 0);
 
             // At least 3 simd lengths remain (as loop is 3x unrolled and we want it to loop at least once)
-            assert(blkSize >= (3 * XMM_REGSIZE_BYTES));
+            assert(blkSize >= (3 * simdSize));
             // In range at start of loop
             assert((alignedLclHi - blkSize) >= untrLclLo);
-            assert(((alignedLclHi - blkSize) + (XMM_REGSIZE_BYTES * 2)) < (untrLclHi - XMM_REGSIZE_BYTES));
+            assert(((alignedLclHi - blkSize) + (simdSize * 2)) < (untrLclHi - simdSize));
             // In range at end of loop
-            assert((alignedLclHi - (3 * XMM_REGSIZE_BYTES) + (2 * XMM_REGSIZE_BYTES)) <=
-                   (untrLclHi - XMM_REGSIZE_BYTES));
-            assert((alignedLclHi - (blkSize + extraSimd * XMM_REGSIZE_BYTES)) == alignedLclLo);
+            assert((alignedLclHi - (3 * simdSize) + (2 * simdSize)) <= (untrLclHi - simdSize));
+            assert((alignedLclHi - (blkSize + extraSize)) == alignedLclLo);
 
             // Set loop counter
             emit->emitIns_R_I(INS_mov, EA_PTRSIZE, initReg, -(ssize_t)blkSize);
             // Loop start
-            emit->emitIns_ARX_R(simdMov, EA_ATTR(XMM_REGSIZE_BYTES), zeroSIMDReg, frameReg, initReg, 1, alignedLclHi);
-            emit->emitIns_ARX_R(simdMov, EA_ATTR(XMM_REGSIZE_BYTES), zeroSIMDReg, frameReg, initReg, 1,
-                                alignedLclHi + XMM_REGSIZE_BYTES);
-            emit->emitIns_ARX_R(simdMov, EA_ATTR(XMM_REGSIZE_BYTES), zeroSIMDReg, frameReg, initReg, 1,
-                                alignedLclHi + 2 * XMM_REGSIZE_BYTES);
+            emit->emitIns_ARX_R(loopSimdMov, EA_ATTR(simdSize), zeroSIMDReg, frameReg, initReg, 1, alignedLclHi);
+            emit->emitIns_ARX_R(loopSimdMov, EA_ATTR(simdSize), zeroSIMDReg, frameReg, initReg, 1,
+                                alignedLclHi + simdSize);
+            emit->emitIns_ARX_R(loopSimdMov, EA_ATTR(simdSize), zeroSIMDReg, frameReg, initReg, 1,
+                                alignedLclHi + 2 * simdSize);
 
-            emit->emitIns_R_I(INS_add, EA_PTRSIZE, initReg, XMM_REGSIZE_BYTES * 3);
+            emit->emitIns_R_I(INS_add, EA_PTRSIZE, initReg, simdSize * 3);
             // Loop until counter is 0
             emit->emitIns_J(INS_jne, nullptr, -5);
 
@@ -5268,6 +5268,7 @@ public:
 
     bool fgRemoveRestOfBlock; // true if we know that we will throw
     bool fgStmtRemoved;       // true if we remove statements -> need new DFA
+    bool fgCurBlockModified;  // true if dead store removal changed compCurBB -> need new use/def sets
 
     enum FlowGraphOrder
     {
@@ -5517,7 +5518,8 @@ public:
     void fgLocalVarLivenessInit();
 
     void fgPerNodeLocalVarLiveness(GenTree* node);
-    void fgPerBlockLocalVarLiveness();
+    void fgBlockLocalVarUseDef(BasicBlock* block);
+    void fgPerBlockLocalVarLiveness(ArrayStack<BasicBlock*>* changedBlocks);
 
 #if defined(FEATURE_HW_INTRINSICS)
     void fgPerNodeLocalVarLiveness(GenTreeHWIntrinsic* hwintrinsic);
@@ -5561,7 +5563,7 @@ public:
                            bool*            pStmtInfoDirty,
                            bool* pStoreRemoved DEBUGARG(bool* treeModf));
 
-    void fgInterBlockLocalVarLiveness();
+    void fgInterBlockLocalVarLiveness(ArrayStack<BasicBlock*>* changedBlocks);
 
     // Blocks: convenience methods for enabling range-based `for` iteration over the function's blocks, e.g.:
     // 1.   for (BasicBlock* const block : compiler->Blocks()) ...
@@ -6953,7 +6955,7 @@ private:
 public:
     PhaseStatus optOptimizeBools();
     PhaseStatus optSwitchRecognition();
-    bool optSwitchConvert(BasicBlock* firstBlock, int testsCount, ssize_t* testValues, weight_t falseLikelihood, GenTree* nodeToTest);
+    bool optSwitchConvert(BasicBlock* firstBlock, int testsCount, ssize_t* testValues, BasicBlock** testTargets, GenTree* nodeToTest);
     bool optSwitchDetectAndConvert(BasicBlock* firstBlock);
 
     PhaseStatus optInvertLoops();    // Invert loops so they're entered at top and tested at bottom.
@@ -7478,6 +7480,14 @@ public:
         return min(MAX_GDV_TYPE_CHECKS, typeChecks);
     }
 
+    int getGDVMaxDelegateChecks()
+    {
+        // A single guess unless more were requested; multiple delegate guesses are opt-in
+        // until their impact on Dynamic PGO has been measured.
+        int delegateChecks = JitConfig.JitGuardedDevirtualizationMaxDelegateChecks();
+        return min(MAX_GDV_TYPE_CHECKS, max(1, delegateChecks));
+    }
+
     bool doesMethodHaveExpRuntimeLookup()
     {
         return (optMethodFlags & OMF_HAS_EXPRUNTIMELOOKUP) != 0;
@@ -29,6 +29,7 @@ CompMemKindMacro(LSRA_RefPosition)
 CompMemKindMacro(Reachability)
 CompMemKindMacro(SSA)
 CompMemKindMacro(ValueNumber)
+CompMemKindMacro(ValueNumberFuncApp)
 CompMemKindMacro(LvaTable)
 CompMemKindMacro(UnwindInfo)
 CompMemKindMacro(hashBv)
@@ -811,8 +811,15 @@ void emitter::emitGenIG(insGroup* ig)
 
     if (emitCurIGfreeBase == nullptr)
     {
+        size_t numLargeDescs = SC_IG_BUFFER_NUM_LARGE_DESCS;
+
+        if (emitComp->info.compILCodeSize >= SC_IG_BUFFER_LARGE_METHOD_IL_SIZE)
+        {
+            numLargeDescs = max(numLargeDescs, (size_t)(EMIT_MAX_IG_INS_COUNT - SC_IG_BUFFER_NUM_SMALL_DESCS));
+        }
+
         emitIGbuffSize = (SC_IG_BUFFER_NUM_SMALL_DESCS * (SMALL_IDSC_SIZE + m_debugInfoSize)) +
-                         (SC_IG_BUFFER_NUM_LARGE_DESCS * (sizeof(emitter::instrDesc) + m_debugInfoSize));
+                         (numLargeDescs * (sizeof(emitter::instrDesc) + m_debugInfoSize));
         emitCurIGfreeBase = (BYTE*)emitGetMem(emitIGbuffSize);
         emitCurIGfreeEndp = emitCurIGfreeBase + emitIGbuffSize;
     }
@@ -2599,6 +2599,14 @@ private:
 #define SC_IG_BUFFER_NUM_LARGE_DESCS 50
 #endif // !(TARGET_ARMARCH || TARGET_LOONGARCH64 || TARGET_RISCV64)
 
+// Methods with at least this many bytes of IL get a buffer that can hold a full instruction group
+// (EMIT_MAX_IG_INS_COUNT descriptors). Such methods (generated parsers, state machines) tend to have
+// long straight-line blocks, and with the default buffer each of those is split into many overflow
+// groups, each costing an insGroup and a step in every later walk over the group list.
+// The cutoff is a heuristic: the larger buffer costs a few KB of arena memory per method, so it is
+// kept to methods where blocks that long are likely.
+#define SC_IG_BUFFER_LARGE_METHOD_IL_SIZE 4096
+
     size_t emitIGbuffSize;
 
     insGroup* emitIGlist; // first  instruction group
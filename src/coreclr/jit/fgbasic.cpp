@@ -99,7 +99,8 @@ void Compiler::fgInit()
     fgPtrArgCntMax = 0;
 
     /* This global flag is set whenever we remove a statement */
-    fgStmtRemoved = false;
+    fgStmtRemoved      = false;
+    fgCurBlockModified = false;
 
     // This global flag is set when we create throw helper blocks
     fgRngChkThrowAdded = false;
@@ -881,6 +881,11 @@ PhaseStatus Compiler::fgInline()
 
 #endif // DEBUG
 
+    if (JitConfig.JitInlineBudgetReport() != 0)
+    {
+        m_inlineStrategy->DumpBudgetReport();
+    }
+
     if (madeChanges)
     {
         // Optional quirk to keep this as zero diff. Some downstream phases are bbNum sensitive
@@ -6718,7 +6718,41 @@ void Compiler::pickGDV(GenTreeCall*           call,
 
     if (numberOfMethods > 0)
     {
-        // For method guessing we only support a single target for now
+        // Delegate call sites (e.g. a Func<T> parameter invoked by a shared helper) are often
+        // polymorphic. Each delegate guess only compares the delegate's method pointer, so allow
+        // multiple targets there, with the same thresholds as used for multiple virtual class guesses.
+        const int maxDelegateGuesses = call->IsDelegateInvoke() ? getGDVMaxDelegateChecks() : 0;
+        if ((maxDelegateGuesses > 1) && (*candidatesCount == 0))
+        {
+            assert(maxDelegateGuesses <= MAX_GDV_TYPE_CHECKS);
+
+            unsigned likelihoodThreshold = (maxDelegateGuesses == 2) ? 20 : 10;
+            unsigned totalGuesses        = min((unsigned)maxDelegateGuesses, numberOfMethods);
+            for (unsigned guessIdx = 0; guessIdx < totalGuesses; guessIdx++)
+            {
+                if (likelyMethods[guessIdx].likelihood < likelihoodThreshold)
+                {
+                    // The candidates are sorted by likelihood so the rest of the
+                    // guesses will have even lower likelihoods
+                    break;
+                }
+
+                methodGuesses[guessIdx] = (CORINFO_METHOD_HANDLE)likelyMethods[guessIdx].handle;
+                likelihoods[guessIdx]   = likelyMethods[guessIdx].likelihood;
+                *candidatesCount        = *candidatesCount + 1;
+                JITDUMP("Accepting delegate target %s with likelihood %u as a candidate\n",
+                        eeGetMethodFullName(methodGuesses[guessIdx]), likelihoods[guessIdx]);
+            }
+
+            if (*candidatesCount == 0)
+            {
+                JITDUMP("Not guessing for delegate; likelihood is below delegate call threshold %u\n",
+                        likelihoodThreshold);
+            }
+            return;
+        }
+
+        // For virtual method guessing we only support a single target for now
         unsigned likelihoodThreshold = 30;
         if (likelyMethods[0].likelihood >= likelihoodThreshold)
         {
@@ -6864,7 +6898,8 @@ void Compiler::considerGuardedDevirtualization(GenTreeCall*            call,
     {
         pickGDV(call, ilOffset, isInterface, likelyClasses, likelyMethods, &candidatesCount, likelihoods);
         assert((unsigned)candidatesCount <= MAX_GDV_TYPE_CHECKS);
-        assert((unsigned)candidatesCount <= (unsigned)getGDVMaxTypeChecks());
+        assert((unsigned)candidatesCount <=
+               (unsigned)(call->IsDelegateInvoke() ? getGDVMaxDelegateChecks() : getGDVMaxTypeChecks()));
         if (candidatesCount == 0)
         {
             hasPgoData = false;
@@ -7018,8 +7053,8 @@ void Compiler::considerGuardedDevirtualization(GenTreeCall*            call,
 
         if (likelyClass == NO_CLASS_HANDLE)
         {
-            // We don't support multiple candidates for method guessing yet.
-            assert(candidateId == 0);
+            // Multiple candidates for method guessing are only supported for delegates.
+            assert((candidateId == 0) || call->IsDelegateInvoke());
 
             // For method GDV do a few more checks that we get for free in the
             // resolve call above for class-based GDV.
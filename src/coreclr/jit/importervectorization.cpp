@@ -129,6 +129,11 @@ GenTree* Compiler::impExpandHalfConstEqualsSIMD(
     }
     assert((byteLen >= simdSize) && (simdSize >= 16));
 
+    // NOTE: the tail is covered by a second load overlapping the first one. Neither load reads
+    // past the end of the data, so this can't fault. A single masked load (vpmaskmovd, or an
+    // AVX-512 masked vmovdqu16) is also fault-safe but has measured slower: it has a longer
+    // latency and needs the mask loaded first.
+
     WCHAR cnsValue[MaxPossibleUnrollSize]    = {};
     WCHAR toLowerMask[MaxPossibleUnrollSize] = {};
 
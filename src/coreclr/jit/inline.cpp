@@ -339,6 +339,7 @@ InlineContext::InlineContext(InlineStrategy* strategy)
     , m_CodeSizeEstimate(0)
     , m_Ordinal(0)
     , m_Success(true)
+    , m_HotReserve(false)
 #if defined(DEBUG)
     , m_Policy(nullptr)
     , m_TreeID(0)
@@ -833,6 +834,8 @@ InlineStrategy::InlineStrategy(Compiler* compiler)
     , m_UnprofitableCandidateCount(0)
     , m_ImportCount(0)
     , m_InlineCount(0)
+    , m_HotOverBudgetCount(0)
+    , m_ColdCallSiteCount(0)
     , m_MaxInlineSize(DEFAULT_MAX_INLINE_SIZE)
     , m_MaxInlineDepth(DEFAULT_MAX_INLINE_DEPTH)
     , m_MaxForceInlineDepth(DEFAULT_MAX_FORCE_INLINE_DEPTH)
@@ -1200,6 +1203,13 @@ void InlineStrategy::NoteOutcome(InlineContext* context)
         // Update time estimate.
         m_CurrentTimeEstimate += timeDelta;
 
+        // Count the inlines that BudgetCheck let go over the regular budget
+        // by drawing on the hot call site reserve (see HotBudgetCheck).
+        if (context->m_HotReserve)
+        {
+            m_HotOverBudgetCount++;
+        }
+
         // Update size estimate.
         //
         // Sometimes estimates don't make sense. Don't let the method
@@ -1243,6 +1253,65 @@ bool InlineStrategy::BudgetCheck(unsigned ilSize)
     return result;
 }
 
+//------------------------------------------------------------------------
+// HotBudgetCheck: return true if an inline of this size at a hot call
+//     site would likely exceed the jit time budget for this method, even
+//     when allowed to draw on the profile-guided reserve.
+//
+// Arguments:
+//     ilSize - size of the method's IL
+//
+// Return Value:
+//     true if the inline would go over the extended budget
+//
+// Notes:
+//     The reserve is JitExtDefaultPolicyHotBudget percent of the initial
+//     budget. Only call sites that profile data shows to be hot may use it,
+//     so inlines in cold code cannot exhaust the budget hot code needs.
+
+bool InlineStrategy::HotBudgetCheck(unsigned ilSize)
+{
+    const int  timeDelta = EstimateInlineTime(ilSize);
+    const int  reserve   = (int)(((INT64)m_InitialTimeBudget * JitConfig.JitExtDefaultPolicyHotBudget()) / 100);
+    const bool result    = (timeDelta + m_CurrentTimeEstimate > m_CurrentTimeBudget + reserve);
+
+    if (result)
+    {
+        JITDUMP("\nHotBudgetCheck: for IL Size %d, timeDelta %d +  currentEstimate %d > currentBudget %d + reserve %d\n",
+                ilSize, timeDelta, m_CurrentTimeEstimate, m_CurrentTimeBudget, reserve);
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------
+// DumpBudgetReport: print a one line summary of how much of the jit time
+//     budget inlining used, and how profile data affected the decisions.
+//
+// Notes:
+//     Enabled by JitInlineBudgetReport; use JitStdOutFile to redirect.
+
+void InlineStrategy::DumpBudgetReport()
+{
+#ifdef DEBUG
+    const char* fullName = m_Compiler->info.compFullName;
+#else
+    const char* fullName = m_Compiler->eeGetMethodFullName(m_Compiler->info.compMethodHnd,
+                                                           /* includeReturnType */ false,
+                                                           /* includeThisSpecifier */ false);
+#endif
+
+    const int reserve = (int)(((INT64)m_InitialTimeBudget * JitConfig.JitExtDefaultPolicyHotBudget()) / 100);
+    const int used    = m_CurrentTimeEstimate - m_InitialTimeEstimate;
+    const int avail   = m_CurrentTimeBudget - m_InitialTimeEstimate;
+
+    printf("Inline budget: %s [%s%s, inlines=%u/%u candidates, time=%d->%d, used=%d/%d (%.1f%%), hot reserve=%d, "
+           "hot over budget=%u, cold skipped=%u]\n",
+           fullName, m_Compiler->fgHaveTrustedProfileWeights() ? "PGO " : "", m_Compiler->compGetTieringName(), m_InlineCount,
+           m_CandidateCount, m_InitialTimeEstimate, m_CurrentTimeEstimate, used, avail,
+           (avail > 0) ? (100.0 * used / avail) : 0.0, reserve, m_HotOverBudgetCount, m_ColdCallSiteCount);
+}
+
 //------------------------------------------------------------------------
 // NewRoot: construct an InlineContext for the root method
 //
@@ -1333,6 +1402,7 @@ void InlineContext::SetSucceeded(const InlineInfo* info)
     m_Observation    = info->inlineResult->GetObservation();
     m_ImportedILSize = info->inlineResult->GetImportedILSize();
     m_Success        = true;
+    m_HotReserve     = info->inlineResult->GetPolicy()->UsesHotBudget();
 
 #if defined(DEBUG)
     m_Policy           = info->inlineResult->GetPolicy();
@@ -1350,6 +1420,7 @@ void InlineContext::SetFailed(const InlineResult* result)
     m_Observation    = result->GetObservation();
     m_ImportedILSize = result->GetImportedILSize();
     m_Success        = false;
+    m_HotReserve     = false;
 
 #if defined(DEBUG)
     m_Policy           = result->GetPolicy();
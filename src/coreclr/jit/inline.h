@@ -242,6 +242,13 @@ public:
     virtual void DetermineProfitability(CORINFO_METHOD_INFO* methodInfo) = 0;
     virtual bool BudgetCheck() const                                     = 0;
 
+    // True if the last BudgetCheck let this inline go over the regular
+    // budget by drawing on the hot call site reserve.
+    virtual bool UsesHotBudget() const
+    {
+        return false;
+    }
+
     // Policy policies
     virtual bool PropagateNeverToRuntime() const = 0;
 
@@ -880,7 +887,8 @@ private:
     InlineObservation      m_Observation;      // what lead to this inline success or failure
     int                    m_CodeSizeEstimate; // in bytes * 10
     unsigned               m_Ordinal;          // Ordinal number of this inline
-    bool                   m_Success : 1;      // true if this was a successful inline
+    bool                   m_Success    : 1;   // true if this was a successful inline
+    bool                   m_HotReserve : 1;   // true if this inline drew on the hot call site budget reserve
 
 #if defined(DEBUG)
 
@@ -1016,6 +1024,20 @@ public:
     // time budget.
     bool BudgetCheck(unsigned ilSize);
 
+    // See if an inline of this size at a hot call site would fit within
+    // the current jit time budget extended by the profile-guided reserve.
+    bool HotBudgetCheck(unsigned ilSize);
+
+    // Inform strategy that a call site was not inlined because profile
+    // data shows it never runs.
+    void NoteColdCallSite()
+    {
+        m_ColdCallSiteCount++;
+    }
+
+    // Dump a summary of the jit time budget usage to jitstdout.
+    void DumpBudgetReport();
+
     // Check if inlining is disabled for the method being jitted
     bool IsInliningDisabled();
 
@@ -1104,6 +1126,8 @@ private:
     unsigned          m_UnprofitableCandidateCount;
     unsigned          m_ImportCount;
     unsigned          m_InlineCount;
+    unsigned          m_HotOverBudgetCount;
+    unsigned          m_ColdCallSiteCount;
     unsigned          m_MaxInlineSize;
     unsigned          m_MaxInlineDepth;
     unsigned          m_MaxForceInlineDepth;
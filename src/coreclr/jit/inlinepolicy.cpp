@@ -1467,6 +1467,41 @@ void ExtendedDefaultPolicy::NoteDouble(InlineObservation obs, double value)
     m_ProfileFrequency = value;
 }
 
+//------------------------------------------------------------------------
+// BudgetCheck: see if this inline would exceed the current budget
+//    Call sites that trusted profile data shows to run at least as often
+//    as the root method may go over the regular budget, drawing on a
+//    reserve that colder call sites can't use up.
+//
+// Returns:
+//   True if inline would exceed the budget.
+//
+bool ExtendedDefaultPolicy::BudgetCheck() const
+{
+    m_UsesHotBudget = false;
+
+    if (!DefaultPolicy::BudgetCheck())
+    {
+        return false;
+    }
+
+    if ((JitConfig.JitExtDefaultPolicyHotBudget() > 0) && m_HasProfileWeights &&
+        m_RootCompiler->fgHaveTrustedProfileWeights() && (m_ProfileFrequency >= 1.0))
+    {
+        const bool overBudget = m_RootCompiler->m_inlineStrategy->HotBudgetCheck(EstimatedTotalILSize());
+
+        if (!overBudget)
+        {
+            JITDUMP("Allowing over-budget for hot callsite (profile frequency %g)\n", m_ProfileFrequency);
+            m_UsesHotBudget = true;
+        }
+
+        return overBudget;
+    }
+
+    return true;
+}
+
 //------------------------------------------------------------------------
 // EstimatedTotalILSize: Estimate final IL size to import.
 //    ExtendedDefaultPolicy has a better understanding on how many branches
@@ -1787,6 +1822,15 @@ double ExtendedDefaultPolicy::DetermineMultiplier()
 
         if (m_RootCompiler->fgHaveTrustedProfileWeights())
         {
+            if ((m_ProfileFrequency == 0.0) && (JitConfig.JitExtDefaultPolicySkipCold() != 0))
+            {
+                // The call site never ran; don't spend any budget on it.
+                multiplier = 0.0;
+                m_RootCompiler->m_inlineStrategy->NoteColdCallSite();
+                JITDUMP("\nCallsite never ran.  Multiplier limited to %g.", multiplier);
+                return multiplier;
+            }
+
             multiplier *= (1.0 - profileTrustCoef) + min(m_ProfileFrequency, 1.0) * profileScale;
         }
         else
@@ -224,6 +224,7 @@ public:
         , m_NonGenericCallsGeneric(false)
         , m_IsCallsiteInNoReturnRegion(false)
         , m_HasProfileWeights(false)
+        , m_UsesHotBudget(false)
     {
         // Empty
     }
@@ -234,6 +235,13 @@ public:
 
     double DetermineMultiplier() override;
 
+    bool BudgetCheck() const override;
+
+    bool UsesHotBudget() const override
+    {
+        return m_UsesHotBudget;
+    }
+
     unsigned EstimatedTotalILSize() const override;
 
     bool RequiresPreciseScan() override
@@ -277,6 +285,8 @@ protected:
     bool     m_NonGenericCallsGeneric     : 1;
     bool     m_IsCallsiteInNoReturnRegion : 1;
     bool     m_HasProfileWeights          : 1;
+    // Set by BudgetCheck, hence mutable.
+    mutable bool m_UsesHotBudget;
 };
 
 // DiscretionaryPolicy is a variant of the default policy.  It
@@ -651,6 +651,18 @@ RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyMaxBB, W("JitExtDefaultPolicyMaxBB"),
 RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyProfTrust, W("JitExtDefaultPolicyProfTrust"), 0x7)
 RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyProfScale, W("JitExtDefaultPolicyProfScale"), 0x2A)
 
+// Extra jit time budget, as a percentage of the initial one, that call sites executed at least as often as
+// the root method (per trusted dynamic PGO) may use once the regular budget is exhausted. 0 (default) disables
+// the reserve until its throughput impact has been measured.
+RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyHotBudget, W("JitExtDefaultPolicyHotBudget"), 0)
+
+// If set, don't inline discretionary candidates at call sites that trusted dynamic PGO shows never ran.
+// Off by default since such inlines can still improve type info/escape analysis for the whole caller.
+RELEASE_CONFIG_INTEGER(JitExtDefaultPolicySkipCold, W("JitExtDefaultPolicySkipCold"), 0)
+
+// If set, print a summary of the inliner's jit time budget usage for each method (see JitStdOutFile).
+RELEASE_CONFIG_INTEGER(JitInlineBudgetReport, W("JitInlineBudgetReport"), 0)
+
 RELEASE_CONFIG_INTEGER(JitInlinePolicyModel, W("JitInlinePolicyModel"), 0)
 RELEASE_CONFIG_INTEGER(JitInlinePolicyProfile, W("JitInlinePolicyProfile"), 0)
 RELEASE_CONFIG_INTEGER(JitInlinePolicyProfileThreshold, W("JitInlinePolicyProfileThreshold"), 40)
@@ -668,6 +680,8 @@ RELEASE_CONFIG_INTEGER(JitEnableGuardedDevirtualization, W("JitEnableGuardedDevi
 // Number of types to probe for polymorphic virtual call-sites to devirtualize them,
 // Max number is MAX_GDV_TYPE_CHECKS defined above ^. -1 means it's up to JIT to decide
 RELEASE_CONFIG_INTEGER(JitGuardedDevirtualizationMaxTypeChecks, W("JitGuardedDevirtualizationMaxTypeChecks"), -1)
+// Number of targets to guess for polymorphic delegate call-sites, same limit as above.
+RELEASE_CONFIG_INTEGER(JitGuardedDevirtualizationMaxDelegateChecks, W("JitGuardedDevirtualizationMaxDelegateChecks"), 1)
 
 // Various policies for GuardedDevirtualization (0x4B == 75)
 RELEASE_CONFIG_INTEGER(JitGuardedDevirtualizationChainLikelihood, W("JitGuardedDevirtualizationChainLikelihood"), 0x4B)
@@ -37,6 +37,7 @@ JITMETADATAMETRIC(LoopsIVWidened,                        int,              0)
 JITMETADATAMETRIC(WidenedIVs,                            int,              0)
 JITMETADATAMETRIC(LoopsMadeDownwardsCounted,             int,              0)
 JITMETADATAMETRIC(VarsInSsa,                             int,              0)
+JITMETADATAMETRIC(LivenessUseDefBlocksReused,            int,              0)
 JITMETADATAMETRIC(HoistedExpressions,                    int,              0)
 JITMETADATAMETRIC(RedundantBranchesEliminated,           int,              JIT_METADATA_HIGHER_IS_BETTER)
 JITMETADATAMETRIC(JumpThreadingsPerformed,               int,              JIT_METADATA_HIGHER_IS_BETTER)
@@ -139,17 +139,24 @@ void Compiler::fgLocalVarLiveness()
     // Initialize the per-block var sets.
     fgInitBlockVarSets();
 
+    // Blocks changed by dead store removal; on the next iteration
+    // only their use/def sets need to be recomputed.
+    ArrayStack<BasicBlock*> changedBlocks(getAllocator(CMK_ArrayStack));
+    bool                    firstIteration = true;
+
     fgLocalVarLivenessChanged = false;
     do
     {
         /* Figure out use/def info for all basic blocks */
-        fgPerBlockLocalVarLiveness();
+        fgPerBlockLocalVarLiveness(firstIteration ? nullptr : &changedBlocks);
         EndPhase(PHASE_LCLVARLIVENESS_PERBLOCK);
 
         /* Live variable analysis. */
 
+        firstIteration = false;
+        changedBlocks.Reset();
         fgStmtRemoved = false;
-        fgInterBlockLocalVarLiveness();
+        fgInterBlockLocalVarLiveness(&changedBlocks);
     } while (fgStmtRemoved && fgLocalVarLivenessChanged);
 
     EndPhase(PHASE_LCLVARLIVENESS_INTERBLOCK);
@@ -332,8 +339,173 @@ void Compiler::fgPerNodeLocalVarLiveness(GenTreeHWIntrinsic* hwintrinsic)
 }
 #endif // FEATURE_HW_INTRINSICS
 
-/*****************************************************************************/
-void Compiler::fgPerBlockLocalVarLiveness()
+//------------------------------------------------------------------------
+// fgBlockLocalVarUseDef: Compute the use/def sets of a single block
+//    and reset its live-in sets.
+//
+// Arguments:
+//    block - The block
+//
+void Compiler::fgBlockLocalVarUseDef(BasicBlock* block)
+{
+    VarSetOps::ClearD(this, fgCurUseSet);
+    VarSetOps::ClearD(this, fgCurDefSet);
+
+    fgCurMemoryUse   = emptyMemoryKindSet;
+    fgCurMemoryDef   = emptyMemoryKindSet;
+    fgCurMemoryHavoc = emptyMemoryKindSet;
+
+    compCurBB = block;
+    if (block->IsLIR())
+    {
+        for (GenTree* node : LIR::AsRange(block))
+        {
+            fgPerNodeLocalVarLiveness(node);
+        }
+    }
+    else if (fgNodeThreading == NodeThreading::AllTrees)
+    {
+        for (Statement* const stmt : block->NonPhiStatements())
+        {
+            compCurStmt = stmt;
+            for (GenTree* const node : stmt->TreeList())
+            {
+                fgPerNodeLocalVarLiveness(node);
+            }
+        }
+    }
+    else
+    {
+        assert(fgIsDoingEarlyLiveness && (fgNodeThreading == NodeThreading::AllLocals));
+
+        if (compQmarkUsed)
+        {
+            for (Statement* stmt : block->Statements())
+            {
+                GenTree* dst;
+                GenTree* qmark = fgGetTopLevelQmark(stmt->GetRootNode(), &dst);
+                if (qmark == nullptr)
+                {
+                    for (GenTreeLclVarCommon* lcl : stmt->LocalsTreeList())
+                    {
+                        fgMarkUseDef(lcl);
+                    }
+                }
+                else
+                {
+                    // Assigned local should be the very last local.
+                    assert((dst == nullptr) ||
+                           ((stmt->GetTreeListEnd() == dst) && ((dst->gtFlags & GTF_VAR_DEF) != 0)));
+
+                    // Conservatively ignore defs that may be conditional
+                    // but would otherwise still interfere with the
+                    // lifetimes we compute here. We generally do not
+                    // handle qmarks very precisely here -- last uses may
+                    // not be marked as such due to interference with other
+                    // qmark arms.
+                    for (GenTreeLclVarCommon* lcl : stmt->LocalsTreeList())
+                    {
+                        bool isUse = ((lcl->gtFlags & GTF_VAR_DEF) == 0) || ((lcl->gtFlags & GTF_VAR_USEASG) != 0);
+                        // We can still handle the pure def at the top level.
+                        bool conditional = lcl != dst;
+                        if (isUse || !conditional)
+                        {
+                            fgMarkUseDef(lcl);
+                        }
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (Statement* stmt : block->Statements())
+            {
+                for (GenTreeLclVarCommon* lcl : stmt->LocalsTreeList())
+                {
+                    fgMarkUseDef(lcl);
+                }
+            }
+        }
+    }
+
+    // Mark the FrameListRoot as used, if applicable.
+
+    if (block->KindIs(BBJ_RETURN) && compMethodRequiresPInvokeFrame())
+    {
+        assert(!opts.ShouldUsePInvokeHelpers() || (info.compLvFrameListRoot == BAD_VAR_NUM));
+        if (!opts.ShouldUsePInvokeHelpers())
+        {
+            // 32-bit targets always pop the frame in the epilog.
+            // For 64-bit targets, we only do this in the epilog for IL stubs;
+            // for non-IL stubs the frame is popped after every PInvoke call.
+#ifdef TARGET_64BIT
+            if (opts.jitFlags->IsSet(JitFlags::JIT_FLAG_IL_STUB))
+#endif
+            {
+                LclVarDsc* varDsc = lvaGetDesc(info.compLvFrameListRoot);
+
+                if (varDsc->lvTracked)
+                {
+                    if (!VarSetOps::IsMember(this, fgCurDefSet, varDsc->lvVarIndex))
+                    {
+                        VarSetOps::AddElemD(this, fgCurUseSet, varDsc->lvVarIndex);
+                    }
+                }
+            }
+        }
+    }
+
+#ifdef DEBUG
+    if (verbose)
+    {
+        VARSET_TP allVars(VarSetOps::Union(this, fgCurUseSet, fgCurDefSet));
+        printf(FMT_BB, block->bbNum);
+        printf(" USE(%d)=", VarSetOps::Count(this, fgCurUseSet));
+        lvaDispVarSet(fgCurUseSet, allVars);
+        for (MemoryKind memoryKind : allMemoryKinds())
+        {
+            if ((fgCurMemoryUse & memoryKindSet(memoryKind)) != 0)
+            {
+                printf(" + %s", memoryKindNames[memoryKind]);
+            }
+        }
+        printf("\n     DEF(%d)=", VarSetOps::Count(this, fgCurDefSet));
+        lvaDispVarSet(fgCurDefSet, allVars);
+        for (MemoryKind memoryKind : allMemoryKinds())
+        {
+            if ((fgCurMemoryDef & memoryKindSet(memoryKind)) != 0)
+            {
+                printf(" + %s", memoryKindNames[memoryKind]);
+            }
+            if ((fgCurMemoryHavoc & memoryKindSet(memoryKind)) != 0)
+            {
+                printf("*");
+            }
+        }
+        printf("\n\n");
+    }
+#endif // DEBUG
+
+    VarSetOps::Assign(this, block->bbVarUse, fgCurUseSet);
+    VarSetOps::Assign(this, block->bbVarDef, fgCurDefSet);
+    block->bbMemoryUse   = fgCurMemoryUse;
+    block->bbMemoryDef   = fgCurMemoryDef;
+    block->bbMemoryHavoc = fgCurMemoryHavoc;
+
+    /* also initialize the IN set, just in case we will do multiple DFAs */
+
+    VarSetOps::AssignNoCopy(this, block->bbLiveIn, VarSetOps::MakeEmpty(this));
+    block->bbMemoryLiveIn = emptyMemoryKindSet;
+}
+
+//------------------------------------------------------------------------
+// fgPerBlockLocalVarLiveness: Compute the use/def sets of the blocks.
+//
+// Arguments:
+//    changedBlocks - nullptr to compute the sets of all blocks; otherwise the blocks
+//                    whose statements were changed since the sets were last computed
+//
+void Compiler::fgPerBlockLocalVarLiveness(ArrayStack<BasicBlock*>* changedBlocks)
 {
 #ifdef DEBUG
     if (verbose)
@@ -402,160 +574,73 @@ void Compiler::fgPerBlockLocalVarLiveness()
     VarSetOps::AssignNoCopy(this, fgCurUseSet, VarSetOps::MakeEmpty(this));
     VarSetOps::AssignNoCopy(this, fgCurDefSet, VarSetOps::MakeEmpty(this));
 
-    // GC Heap and ByrefExposed can share states unless we see a def of byref-exposed
-    // memory that is not a GC Heap def.
-    byrefStatesMatchGcHeapStates = true;
-
-    for (block = fgFirstBB; block; block = block->Next())
+    // On a re-run after dead store removal, only the blocks where stores were removed or
+    // replaced by their side effects have different use/def sets. Removal only drops uses and
+    // defs, so if the GcHeap and ByrefExposed states matched before they still do, and the sets
+    // of all other blocks can be kept as they are. LIR liveness also removes dead calls and
+    // other unused nodes without tracking the blocks, so it always does the full walk. So does
+    // debuggable code with scopes, where fgExtendDbgLifetimes adds the scopes to the sets.
+    if ((changedBlocks != nullptr) && byrefStatesMatchGcHeapStates && (fgNodeThreading != NodeThreading::LIR) &&
+        !(opts.compDbgCode && (info.compVarScopesCount > 0)))
     {
-        VarSetOps::ClearD(this, fgCurUseSet);
-        VarSetOps::ClearD(this, fgCurDefSet);
-
-        fgCurMemoryUse   = emptyMemoryKindSet;
-        fgCurMemoryDef   = emptyMemoryKindSet;
-        fgCurMemoryHavoc = emptyMemoryKindSet;
-
-        compCurBB = block;
-        if (block->IsLIR())
-        {
-            for (GenTree* node : LIR::AsRange(block))
-            {
-                fgPerNodeLocalVarLiveness(node);
-            }
-        }
-        else if (fgNodeThreading == NodeThreading::AllTrees)
-        {
-            for (Statement* const stmt : block->NonPhiStatements())
-            {
-                compCurStmt = stmt;
-                for (GenTree* const node : stmt->TreeList())
-                {
-                    fgPerNodeLocalVarLiveness(node);
-                }
-            }
-        }
-        else
+        unsigned reusedCount = 0;
+        for (block = fgFirstBB; block; block = block->Next())
         {
-            assert(fgIsDoingEarlyLiveness && (fgNodeThreading == NodeThreading::AllLocals));
-
-            if (compQmarkUsed)
-            {
-                for (Statement* stmt : block->Statements())
-                {
-                    GenTree* dst;
-                    GenTree* qmark = fgGetTopLevelQmark(stmt->GetRootNode(), &dst);
-                    if (qmark == nullptr)
-                    {
-                        for (GenTreeLclVarCommon* lcl : stmt->LocalsTreeList())
-                        {
-                            fgMarkUseDef(lcl);
-                        }
-                    }
-                    else
-                    {
-                        // Assigned local should be the very last local.
-                        assert((dst == nullptr) ||
-                               ((stmt->GetTreeListEnd() == dst) && ((dst->gtFlags & GTF_VAR_DEF) != 0)));
-
-                        // Conservatively ignore defs that may be conditional
-                        // but would otherwise still interfere with the
-                        // lifetimes we compute here. We generally do not
-                        // handle qmarks very precisely here -- last uses may
-                        // not be marked as such due to interference with other
-                        // qmark arms.
-                        for (GenTreeLclVarCommon* lcl : stmt->LocalsTreeList())
-                        {
-                            bool isUse = ((lcl->gtFlags & GTF_VAR_DEF) == 0) || ((lcl->gtFlags & GTF_VAR_USEASG) != 0);
-                            // We can still handle the pure def at the top level.
-                            bool conditional = lcl != dst;
-                            if (isUse || !conditional)
-                            {
-                                fgMarkUseDef(lcl);
-                            }
-                        }
-                    }
-                }
-            }
-            else
-            {
-                for (Statement* stmt : block->Statements())
-                {
-                    for (GenTreeLclVarCommon* lcl : stmt->LocalsTreeList())
-                    {
-                        fgMarkUseDef(lcl);
-                    }
-                }
-            }
+            VarSetOps::AssignNoCopy(this, block->bbLiveIn, VarSetOps::MakeEmpty(this));
+            block->bbMemoryLiveIn = emptyMemoryKindSet;
+            reusedCount++;
         }
 
-        // Mark the FrameListRoot as used, if applicable.
-
-        if (block->KindIs(BBJ_RETURN) && compMethodRequiresPInvokeFrame())
+        for (int i = 0; i < changedBlocks->Height(); i++)
         {
-            assert(!opts.ShouldUsePInvokeHelpers() || (info.compLvFrameListRoot == BAD_VAR_NUM));
-            if (!opts.ShouldUsePInvokeHelpers())
-            {
-                // 32-bit targets always pop the frame in the epilog.
-                // For 64-bit targets, we only do this in the epilog for IL stubs;
-                // for non-IL stubs the frame is popped after every PInvoke call.
-#ifdef TARGET_64BIT
-                if (opts.jitFlags->IsSet(JitFlags::JIT_FLAG_IL_STUB))
-#endif
-                {
-                    LclVarDsc* varDsc = lvaGetDesc(info.compLvFrameListRoot);
-
-                    if (varDsc->lvTracked)
-                    {
-                        if (!VarSetOps::IsMember(this, fgCurDefSet, varDsc->lvVarIndex))
-                        {
-                            VarSetOps::AddElemD(this, fgCurUseSet, varDsc->lvVarIndex);
-                        }
-                    }
-                }
-            }
+            fgBlockLocalVarUseDef(changedBlocks->Bottom(i));
         }
 
+        reusedCount -= changedBlocks->Height();
+        JITDUMP("Recomputed use/def sets of %d changed blocks, kept %u\n", changedBlocks->Height(), reusedCount);
+        Metrics.LivenessUseDefBlocksReused += reusedCount;
+
 #ifdef DEBUG
-        if (verbose)
+        // Check that the kept sets are the ones a full recomputation produces.
         {
-            VARSET_TP allVars(VarSetOps::Union(this, fgCurUseSet, fgCurDefSet));
-            printf(FMT_BB, block->bbNum);
-            printf(" USE(%d)=", VarSetOps::Count(this, fgCurUseSet));
-            lvaDispVarSet(fgCurUseSet, allVars);
-            for (MemoryKind memoryKind : allMemoryKinds())
-            {
-                if ((fgCurMemoryUse & memoryKindSet(memoryKind)) != 0)
-                {
-                    printf(" + %s", memoryKindNames[memoryKind]);
-                }
-            }
-            printf("\n     DEF(%d)=", VarSetOps::Count(this, fgCurDefSet));
-            lvaDispVarSet(fgCurDefSet, allVars);
-            for (MemoryKind memoryKind : allMemoryKinds())
+            VARSET_TP  keptUse(VarSetOps::MakeEmpty(this));
+            VARSET_TP  keptDef(VarSetOps::MakeEmpty(this));
+            const bool oldVerbose = verbose;
+
+            verbose = false;
+            for (block = fgFirstBB; block; block = block->Next())
             {
-                if ((fgCurMemoryDef & memoryKindSet(memoryKind)) != 0)
-                {
-                    printf(" + %s", memoryKindNames[memoryKind]);
-                }
-                if ((fgCurMemoryHavoc & memoryKindSet(memoryKind)) != 0)
-                {
-                    printf("*");
-                }
+                VarSetOps::Assign(this, keptUse, block->bbVarUse);
+                VarSetOps::Assign(this, keptDef, block->bbVarDef);
+                const MemoryKindSet keptMemoryUse   = block->bbMemoryUse;
+                const MemoryKindSet keptMemoryDef   = block->bbMemoryDef;
+                const MemoryKindSet keptMemoryHavoc = block->bbMemoryHavoc;
+
+                fgBlockLocalVarUseDef(block);
+
+                assert(VarSetOps::Equal(this, keptUse, block->bbVarUse));
+                assert(VarSetOps::Equal(this, keptDef, block->bbVarDef));
+                assert(keptMemoryUse == block->bbMemoryUse);
+                assert(keptMemoryDef == block->bbMemoryDef);
+                assert(keptMemoryHavoc == block->bbMemoryHavoc);
             }
-            printf("\n\n");
+            verbose = oldVerbose;
+
+            // Recomputing must not have found a byref-exposed def that is not a GcHeap def either.
+            assert(byrefStatesMatchGcHeapStates);
         }
 #endif // DEBUG
+    }
+    else
+    {
+        // GC Heap and ByrefExposed can share states unless we see a def of byref-exposed
+        // memory that is not a GC Heap def.
+        byrefStatesMatchGcHeapStates = true;
 
-        VarSetOps::Assign(this, block->bbVarUse, fgCurUseSet);
-        VarSetOps::Assign(this, block->bbVarDef, fgCurDefSet);
-        block->bbMemoryUse   = fgCurMemoryUse;
-        block->bbMemoryDef   = fgCurMemoryDef;
-        block->bbMemoryHavoc = fgCurMemoryHavoc;
-
-        /* also initialize the IN set, just in case we will do multiple DFAs */
-
-        VarSetOps::AssignNoCopy(this, block->bbLiveIn, VarSetOps::MakeEmpty(this));
-        block->bbMemoryLiveIn = emptyMemoryKindSet;
+        for (block = fgFirstBB; block; block = block->Next())
+        {
+            fgBlockLocalVarUseDef(block);
+        }
     }
 
     noway_assert(livenessVarEpoch == GetCurLVEpoch());
@@ -1632,6 +1717,8 @@ GenTree* Compiler::fgTryRemoveDeadStoreEarly(Statement* stmt, GenTreeLclVarCommo
     // The def ought to be the last thing.
     assert(stmt->GetTreeListEnd() == cur);
 
+    fgCurBlockModified = true;
+
     GenTree* sideEffects = nullptr;
     gtExtractSideEffList(stmt->GetRootNode()->AsLclVarCommon()->Data(), &sideEffects);
 
@@ -2123,7 +2210,8 @@ bool Compiler::fgRemoveDeadStore(GenTree**           pTree,
     }
 
     // We are now committed to removing the store.
-    *pStoreRemoved = true;
+    *pStoreRemoved     = true;
+    fgCurBlockModified = true;
 
     GenTreeLclVarCommon* store = tree->AsLclVarCommon();
     GenTree*             value = store->Data();
@@ -2293,9 +2381,10 @@ bool Compiler::fgRemoveDeadStore(GenTree**           pTree,
 /*****************************************************************************
  *
  *  Iterative data flow for live variable info and availability of range
- *  check index expressions.
+ *  check index expressions. Blocks whose statements are changed by dead
+ *  store removal are pushed on changedBlocks.
  */
-void Compiler::fgInterBlockLocalVarLiveness()
+void Compiler::fgInterBlockLocalVarLiveness(ArrayStack<BasicBlock*>* changedBlocks)
 {
 #ifdef DEBUG
     if (verbose)
@@ -2427,6 +2516,9 @@ void Compiler::fgInterBlockLocalVarLiveness()
 
         compCurBB = block;
 
+        /* Track dead store removal per block, see fgPerBlockLocalVarLiveness */
+        fgCurBlockModified = false;
+
         /* Remember those vars live on entry to exception handlers */
         /* if we are part of a try block */
         VarSetOps::ClearD(this, volatileVars);
@@ -2595,6 +2687,11 @@ void Compiler::fgInterBlockLocalVarLiveness()
             /* compute the new bbLiveOut for all the predecessors of this block */
         }
 
+        if (fgCurBlockModified)
+        {
+            changedBlocks->Push(block);
+        }
+
         noway_assert(compCurBB == block);
 #ifdef DEBUG
         compCurBB = nullptr;
@@ -2672,17 +2769,24 @@ PhaseStatus Compiler::fgEarlyLiveness()
     // Initialize the per-block var sets.
     fgInitBlockVarSets();
 
+    // Blocks changed by dead store removal; on the next iteration
+    // only their use/def sets need to be recomputed.
+    ArrayStack<BasicBlock*> changedBlocks(getAllocator(CMK_ArrayStack));
+    bool                    firstIteration = true;
+
     fgLocalVarLivenessChanged = false;
     do
     {
         /* Figure out use/def info for all basic blocks */
-        fgPerBlockLocalVarLiveness();
+        fgPerBlockLocalVarLiveness(firstIteration ? nullptr : &changedBlocks);
         EndPhase(PHASE_LCLVARLIVENESS_PERBLOCK);
 
         /* Live variable analysis. */
 
+        firstIteration = false;
+        changedBlocks.Reset();
         fgStmtRemoved = false;
-        fgInterBlockLocalVarLiveness();
+        fgInterBlockLocalVarLiveness(&changedBlocks);
     } while (fgStmtRemoved && fgLocalVarLivenessChanged);
 
     fgIsDoingEarlyLiveness = false;
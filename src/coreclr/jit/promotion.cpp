@@ -287,6 +287,19 @@ struct PrimitiveAccess
     }
 };
 
+// A profitable replacement candidate, with its estimated cycle improvement.
+struct ReplacementCandidate
+{
+    size_t   AccessIndex;
+    weight_t Benefit;
+
+    ReplacementCandidate(size_t accessIndex, weight_t benefit)
+        : AccessIndex(accessIndex)
+        , Benefit(benefit)
+    {
+    }
+};
+
 // Tracks all the accesses into one particular struct local.
 class LocalUses
 {
@@ -459,8 +472,7 @@ public:
 
         JITDUMP("Picking promotions for V%02u\n", lclNum);
 
-        AggregateInfo* agg     = nullptr;
-        int            numReps = 0;
+        jitstd::vector<ReplacementCandidate> candidates(comp->getAllocator(CMK_Promotion));
         for (size_t i = 0; i < m_accesses.size(); i++)
         {
             const Access& access = m_accesses[i];
@@ -470,30 +482,65 @@ public:
                 continue;
             }
 
-            if (!EvaluateReplacement(comp, lclNum, access, 0, 0))
+            weight_t benefit;
+            if (!EvaluateReplacement(comp, lclNum, access, 0, 0, &benefit))
             {
                 continue;
             }
 
-            if (agg == nullptr)
-            {
-                agg = new (comp, CMK_Promotion) AggregateInfo(comp->getAllocator(CMK_Promotion), lclNum);
-                aggregates.Add(agg);
-            }
+            candidates.push_back(ReplacementCandidate(i, benefit));
+        }
+
+        if (candidates.empty())
+        {
+            JITDUMP("\n");
+            return 0;
+        }
+
+        // Large structs (e.g. inline arrays) may have more profitable
+        // candidates than we are willing to promote. Instead of simply taking
+        // the candidates with the lowest offsets, keep the ones with the
+        // highest estimated improvement.
+        if (candidates.size() > PHYSICAL_PROMOTION_MAX_PROMOTIONS_PER_STRUCT)
+        {
+            JITDUMP("  V%02u has %zu profitable candidates; keeping the %d most profitable ones\n", lclNum,
+                    candidates.size(), PHYSICAL_PROMOTION_MAX_PROMOTIONS_PER_STRUCT);
+
+            jitstd::sort(candidates.begin(), candidates.end(),
+                         [](const ReplacementCandidate& l, const ReplacementCandidate& r) {
+                if (l.Benefit != r.Benefit)
+                {
+                    return l.Benefit > r.Benefit;
+                }
+
+                return l.AccessIndex < r.AccessIndex;
+            });
 
+            candidates.resize(PHYSICAL_PROMOTION_MAX_PROMOTIONS_PER_STRUCT, ReplacementCandidate(0, 0));
+
+            // Replacements are kept sorted by offset.
+            jitstd::sort(candidates.begin(), candidates.end(),
+                         [](const ReplacementCandidate& l, const ReplacementCandidate& r) {
+                return l.AccessIndex < r.AccessIndex;
+            });
+        }
+
+        AggregateInfo* agg = new (comp, CMK_Promotion) AggregateInfo(comp->getAllocator(CMK_Promotion), lclNum);
+        aggregates.Add(agg);
+
+        for (const ReplacementCandidate& candidate : candidates)
+        {
+            const Access& access = m_accesses[candidate.AccessIndex];
             agg->Replacements.push_back(Replacement(access.Offset, access.AccessType));
-            numReps++;
+        }
 
-            if (agg->Replacements.size() >= PHYSICAL_PROMOTION_MAX_PROMOTIONS_PER_STRUCT)
-            {
-                JITDUMP("  Promoted %zu fields in V%02u; will not promote more\n", agg->Replacements.size(),
-                        agg->LclNum);
-                break;
-            }
+        if (agg->Replacements.size() >= PHYSICAL_PROMOTION_MAX_PROMOTIONS_PER_STRUCT)
+        {
+            JITDUMP("  Promoted %zu fields in V%02u; will not promote more\n", agg->Replacements.size(), agg->LclNum);
         }
 
         JITDUMP("\n");
-        return numReps;
+        return (int)agg->Replacements.size();
     }
 
     //------------------------------------------------------------------------
@@ -621,11 +668,18 @@ public:
     //   access          - Access information for the candidate.
     //   inducedCountWtd - Additional weighted count due to induced accesses.
     //
+    //   benefit         - [out] If non-null and the replacement is profitable,
+    //                     the estimated cycle improvement per invocation.
+    //
     // Returns:
     //   True if we should promote this access and create a replacement; otherwise false.
     //
-    bool EvaluateReplacement(
-        Compiler* comp, unsigned lclNum, const Access& access, unsigned inducedCount, weight_t inducedCountWtd)
+    bool EvaluateReplacement(Compiler*     comp,
+                             unsigned      lclNum,
+                             const Access& access,
+                             unsigned      inducedCount,
+                             weight_t      inducedCountWtd,
+                             weight_t*     benefit = nullptr)
     {
         // Verify that this replacement has proper GC ness compared to the
         // layout. While reinterpreting GC fields to integers can be considered
@@ -809,6 +863,7 @@ public:
             ((cycleImprovementPerInvoc * ALLOWED_SIZE_REGRESSION_PER_CYCLE_IMPROVEMENT) >= -sizeImprovement))
         {
             JITDUMP("  Promoting replacement (cycle improvement)\n\n");
+            SetBenefit(benefit, cycleImprovementPerInvoc);
             return true;
         }
 
@@ -822,6 +877,7 @@ public:
             ((sizeImprovement * ALLOWED_CYCLE_REGRESSION_PER_SIZE_IMPROVEMENT) >= -cycleImprovementPerInvoc))
         {
             JITDUMP("  Promoting replacement (size improvement)\n\n");
+            SetBenefit(benefit, cycleImprovementPerInvoc);
             return true;
         }
 
@@ -829,6 +885,7 @@ public:
         if (comp->compStressCompile(Compiler::STRESS_PHYSICAL_PROMOTION_COST, 25))
         {
             JITDUMP("  Promoting replacement (stress)\n\n");
+            SetBenefit(benefit, cycleImprovementPerInvoc);
             return true;
         }
 #endif
@@ -837,6 +894,18 @@ public:
         return false;
     }
 
+    //------------------------------------------------------------------------
+    // SetBenefit:
+    //   Report the estimated benefit of a replacement, if requested.
+    //
+    static void SetBenefit(weight_t* benefit, weight_t value)
+    {
+        if (benefit != nullptr)
+        {
+            *benefit = value;
+        }
+    }
+
     //------------------------------------------------------------------------
     // ClearInducedAccesses:
     //   Clear the stored induced access metrics.
@@ -11,7 +11,8 @@
 // avoid pathological cases (e.g. machine generated code). Furthermore,
 // writebacks before struct uses introduce commas with nested trees for each
 // field written back, so without a limit we could create arbitrarily deep
-// trees.
+// trees. When a struct has more profitable candidates than this, the ones with
+// the highest estimated improvement are picked.
 const int PHYSICAL_PROMOTION_MAX_PROMOTIONS_PER_STRUCT = 64;
 
 // Represents a single replacement of a (field) access into a struct local.
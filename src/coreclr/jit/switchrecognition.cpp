@@ -11,11 +11,17 @@
 #define SWITCH_MAX_DISTANCE ((TARGET_POINTER_SIZE * BITS_PER_BYTE) - 1)
 #define SWITCH_MIN_TESTS    3
 
+// Chains whose tests jump to different targets can't become a bit test, so they end up as a real
+// jump table and an indirect branch, which Lowering won't turn back into compares. Only form one
+// when there are enough distinct cases and the table is dense (same 50% density Roslyn uses).
+#define SWITCH_MIN_DISTINCT_TARGETS 3
+#define SWITCH_MIN_DENSITY_PERCENT  50
+
 //-----------------------------------------------------------------------------
 //  optSwitchRecognition: Optimize range check for `x == cns1 || x == cns2 || x == cns3 ...`
 //      pattern and convert it to Switch block (jump table) which is then *might* be converted
-//      to a bitmap test via TryLowerSwitchToBitTest.
-//      TODO: recognize general jump table patterns.
+//      to a bitmap test via TryLowerSwitchToBitTest. Chains where each test jumps to its own
+//      target (`if (x == cns1) goto L1; if (x == cns2) goto L2; ...`) become general jump tables.
 //
 //  Return Value:
 //      MODIFIED_EVERYTHING if the optimization was applied.
@@ -158,18 +164,25 @@ bool Compiler::optSwitchDetectAndConvert(BasicBlock* firstBlock)
             return false;
         }
 
+        if ((trueTarget == falseTarget) || !firstBlock->FalseTargetIs(firstBlock->Next()))
+        {
+            return false;
+        }
+
         // No more than SWITCH_MAX_TABLE_SIZE blocks are allowed (arbitrary limit in this context)
-        int     testValueIndex                  = 0;
-        ssize_t testValues[SWITCH_MAX_DISTANCE] = {};
-        testValues[testValueIndex]              = cns;
+        int         testValueIndex                   = 0;
+        ssize_t     testValues[SWITCH_MAX_DISTANCE]  = {};
+        BasicBlock* testTargets[SWITCH_MAX_DISTANCE] = {};
+        testValues[testValueIndex]                   = cns;
+        testTargets[testValueIndex]                  = trueTarget;
         testValueIndex++;
 
-        // Track likelihood of reaching the false block
-        //
-        weight_t          falseLikelihood = firstBlock->GetFalseEdge()->getLikelihood();
-        const BasicBlock* prevBlock       = firstBlock;
+        const BasicBlock* prevBlock = firstBlock;
 
-        // Now walk the next blocks and see if they are basically the same type of test
+        // Now walk the next blocks and see if they are basically the same type of test.
+        // Each test may jump to its own target (e.g. the per-length or per-char dispatch
+        // Roslyn emits for switches on strings), in which case the chain becomes a jump
+        // table with several distinct cases.
         for (const BasicBlock* currBb = firstBlock->Next(); currBb != nullptr; currBb = currBb->Next())
         {
             GenTree*    currVariableNode = nullptr;
@@ -181,51 +194,54 @@ bool Compiler::optSwitchDetectAndConvert(BasicBlock* firstBlock)
             {
                 // Only the first conditional block can have multiple statements.
                 // Stop searching and process what we already have.
-                return optSwitchConvert(firstBlock, testValueIndex, testValues, falseLikelihood, variableNode);
+                return optSwitchConvert(firstBlock, testValueIndex, testValues, testTargets, variableNode);
             }
 
             // Inspect secondary blocks
             if (IsConstantTestCondBlock(currBb, &currTrueTarget, &currFalseTarget, &isReversed, &currVariableNode,
                                         &currCns))
             {
-                if (currTrueTarget != trueTarget)
+                if ((currTrueTarget == currFalseTarget) || (currTrueTarget == firstBlock))
                 {
-                    // This blocks jumps to a different target, stop searching and process what we already have.
-                    return optSwitchConvert(firstBlock, testValueIndex, testValues, falseLikelihood, variableNode);
+                    // This block doesn't branch to a separate case, stop searching and process what we already
+                    // have.
+                    return optSwitchConvert(firstBlock, testValueIndex, testValues, testTargets, variableNode);
                 }
 
                 if (!GenTree::Compare(currVariableNode, variableNode))
                 {
                     // A different variable node is used, stop searching and process what we already have.
-                    return optSwitchConvert(firstBlock, testValueIndex, testValues, falseLikelihood, variableNode);
+                    return optSwitchConvert(firstBlock, testValueIndex, testValues, testTargets, variableNode);
                 }
 
-                if (currBb->GetUniquePred(this) != prevBlock)
+                if ((currBb->GetUniquePred(this) != prevBlock) || !prevBlock->FalseTargetIs(currBb))
                 {
-                    // Multiple preds in a secondary block, stop searching and process what we already have.
-                    return optSwitchConvert(firstBlock, testValueIndex, testValues, falseLikelihood, variableNode);
+                    // Multiple preds in a secondary block, or it isn't reached when the previous test
+                    // fails; stop searching and process what we already have.
+                    return optSwitchConvert(firstBlock, testValueIndex, testValues, testTargets, variableNode);
                 }
 
                 if (!BasicBlock::sameEHRegion(prevBlock, currBb))
                 {
                     // Current block is in a different EH region, stop searching and process what we already have.
-                    return optSwitchConvert(firstBlock, testValueIndex, testValues, falseLikelihood, variableNode);
+                    return optSwitchConvert(firstBlock, testValueIndex, testValues, testTargets, variableNode);
                 }
 
                 // Ok we can work with that, add the test value to the list
-                testValues[testValueIndex++] = currCns;
-                falseLikelihood *= currBb->GetFalseEdge()->getLikelihood();
+                testValues[testValueIndex]  = currCns;
+                testTargets[testValueIndex] = currTrueTarget;
+                testValueIndex++;
 
                 if (testValueIndex == SWITCH_MAX_DISTANCE)
                 {
                     // Too many suitable tests found - stop and process what we already have.
-                    return optSwitchConvert(firstBlock, testValueIndex, testValues, falseLikelihood, variableNode);
+                    return optSwitchConvert(firstBlock, testValueIndex, testValues, testTargets, variableNode);
                 }
 
                 if (isReversed)
                 {
                     // We only support reversed test (GT_NE) for the last block.
-                    return optSwitchConvert(firstBlock, testValueIndex, testValues, falseLikelihood, variableNode);
+                    return optSwitchConvert(firstBlock, testValueIndex, testValues, testTargets, variableNode);
                 }
 
                 prevBlock = currBb;
@@ -233,7 +249,7 @@ bool Compiler::optSwitchDetectAndConvert(BasicBlock* firstBlock)
             else
             {
                 // Current block is not a suitable test, stop searching and process what we already have.
-                return optSwitchConvert(firstBlock, testValueIndex, testValues, falseLikelihood, variableNode);
+                return optSwitchConvert(firstBlock, testValueIndex, testValues, testTargets, variableNode);
             }
         }
     }
@@ -244,21 +260,21 @@ bool Compiler::optSwitchDetectAndConvert(BasicBlock* firstBlock)
 //------------------------------------------------------------------------------
 // optSwitchConvert : Convert a series of conditional blocks into a switch block
 //    conditional blocks are blocks that have a single statement that is a GT_EQ
-//    or GT_NE node. The blocks are expected jump into the same target and test
-//    the same variable against different constants
+//    or GT_NE node. The blocks test the same variable against different constants,
+//    and each jumps to its own case target when the test succeeds.
 //
 // Arguments:
 //    firstBlock - First conditional block in the chain
 //    testsCount - Number of conditional blocks in the chain
 //    testValues - Array of constants that are tested against the variable
-//    falseLikelihood - Likelihood of control flow reaching the false block
+//    testTargets - Array of the blocks each test jumps to when it succeeds
 //    nodeToTest - Variable node that is tested against the constants
 //
 // Return Value:
 //    True if the conversion was successful, false otherwise
 //
 bool Compiler::optSwitchConvert(
-    BasicBlock* firstBlock, int testsCount, ssize_t* testValues, weight_t falseLikelihood, GenTree* nodeToTest)
+    BasicBlock* firstBlock, int testsCount, ssize_t* testValues, BasicBlock** testTargets, GenTree* nodeToTest)
 {
     assert(firstBlock->KindIs(BBJ_COND));
     assert(!varTypeIsSmall(nodeToTest));
@@ -308,17 +324,73 @@ bool Compiler::optSwitchConvert(
         return false;
     }
 
+    // Count the distinct case targets; a single one means the chain can likely become a bit test.
+    int distinctTargets = 0;
+    for (int i = 0; i < testsCount; i++)
+    {
+        bool isNewTarget = true;
+        for (int j = 0; j < i; j++)
+        {
+            if (testTargets[j] == testTargets[i])
+            {
+                isNewTarget = false;
+                break;
+            }
+        }
+
+        if (isNewTarget)
+        {
+            distinctTargets++;
+        }
+    }
+
+    const bool isMultiTarget = distinctTargets > 1;
+    if (isMultiTarget)
+    {
+        if (distinctTargets < SWITCH_MIN_DISTINCT_TARGETS)
+        {
+            JITDUMP("Only %d distinct targets in a multi-target chain, not converting to a switch\n",
+                    distinctTargets);
+            return false;
+        }
+
+        if ((testsCount * 100) < ((maxValue - minValue + 1) * SWITCH_MIN_DENSITY_PERCENT))
+        {
+            JITDUMP("%d tests over the range [%zd..%zd] is too sparse for a jump table\n", testsCount, minValue,
+                    maxValue);
+            return false;
+        }
+    }
+
     // if MaxValue is less than SWITCH_MAX_DISTANCE then don't bother with SUB(val, minValue)
-    if (maxValue <= SWITCH_MAX_DISTANCE)
+    // (unless that would make the jump table of a multi-target chain sparse).
+    if ((maxValue <= SWITCH_MAX_DISTANCE) &&
+        (!isMultiTarget || ((testsCount * 100) >= ((maxValue + 1) * SWITCH_MIN_DENSITY_PERCENT))))
     {
         minValue = 0;
     }
 
-    // Find the last block in the chain
-    const BasicBlock* lastBlock = firstBlock;
-    for (int i = 0; i < testsCount - 1; i++)
+    // Find the last block in the chain, and compute the likelihood of reaching each
+    // case (and the default) from firstBlock.
+    weight_t          testLikelihoods[SWITCH_MAX_DISTANCE];
+    weight_t          falseLikelihood = 1.0;
+    const BasicBlock* lastBlock       = firstBlock;
+    for (int i = 0; i < testsCount; i++)
     {
-        lastBlock = lastBlock->Next();
+        if (i > 0)
+        {
+            lastBlock = lastBlock->Next();
+        }
+
+        BasicBlock* testTrueTarget  = nullptr;
+        BasicBlock* testFalseTarget = nullptr;
+        bool        testIsReversed  = false;
+        const bool  isTest = IsConstantTestCondBlock(lastBlock, &testTrueTarget, &testFalseTarget, &testIsReversed);
+        assert(isTest && (testTrueTarget == testTargets[i]));
+
+        const FlowEdge* const testTrueEdge = testIsReversed ? lastBlock->GetFalseEdge() : lastBlock->GetTrueEdge();
+        testLikelihoods[i]                 = falseLikelihood * testTrueEdge->getLikelihood();
+        falseLikelihood *= (1.0 - testTrueEdge->getLikelihood());
     }
 
     BasicBlock* blockIfTrue  = nullptr;
@@ -327,7 +399,7 @@ bool Compiler::optSwitchConvert(
     const bool  isTest       = IsConstantTestCondBlock(lastBlock, &blockIfTrue, &blockIfFalse, &isReversed);
     assert(isTest);
 
-    assert(firstBlock->TrueTargetIs(blockIfTrue));
+    assert(firstBlock->TrueTargetIs(testTargets[0]));
     FlowEdge* const trueEdge  = firstBlock->GetTrueEdge();
     FlowEdge* const falseEdge = firstBlock->GetFalseEdge();
 
@@ -349,8 +421,11 @@ bool Compiler::optSwitchConvert(
     fgSetStmtSeq(firstBlock->lastStmt());
     gtUpdateStmtSideEffects(firstBlock->lastStmt());
 
-    // Unlink and remove the whole chain of conditional blocks
+    // Unlink firstBlock from its old successors, we're going to link the cases again below.
+    fgRemoveRefPred(trueEdge);
     fgRemoveRefPred(falseEdge);
+
+    // Remove the whole chain of conditional blocks
     BasicBlock* blockToRemove = falseEdge->getDestinationBlock();
     assert(firstBlock->NextIs(blockToRemove));
     while (!lastBlock->NextIs(blockToRemove))
@@ -368,18 +443,16 @@ bool Compiler::optSwitchConvert(
     // (We only need this if the false target is behind firstBlock,
     // but it's cheaper to just check if the false target has diverged)
     // TODO-NoFallThrough: Revisit this quirk?
-    bool skipPredRemoval = false;
     if (!lastBlock->FalseTargetIs(lastBlock->Next()))
     {
         if (isReversed)
         {
             assert(lastBlock->FalseTargetIs(blockIfTrue));
-            fgRemoveRefPred(trueEdge);
             BasicBlock* targetBlock = blockIfTrue;
             blockIfTrue             = fgNewBBafter(BBJ_ALWAYS, firstBlock, true);
             FlowEdge* const newEdge = fgAddRefPred(targetBlock, blockIfTrue);
-            skipPredRemoval         = true;
             blockIfTrue->SetTargetEdge(newEdge);
+            testTargets[testsCount - 1] = blockIfTrue;
         }
         else
         {
@@ -400,44 +473,45 @@ bool Compiler::optSwitchConvert(
     // Splitting doesn't work well with jump-tables currently
     opts.compProcedureSplitting = false;
 
-    // Compose a bit vector of all the values we have in the testValues array
-    // to quickly check if a value is in the array
-    ssize_t bitVector = 0;
+    // Map each value in the range to the target of the first test that checks it;
+    // later tests of the same value were unreachable.
+    BasicBlock* caseTargets[SWITCH_MAX_DISTANCE + 1] = {};
+    unsigned    testCases[SWITCH_MAX_DISTANCE];
     for (testIdx = 0; testIdx < testsCount; testIdx++)
     {
-        assert(testIdx <= (int)((sizeof(ssize_t) * BITS_PER_BYTE) - 1));
-        bitVector |= (ssize_t)(1ULL << static_cast<unsigned>((testValues[testIdx] - minValue)));
-    }
-
-    // Unlink blockIfTrue from firstBlock, we're going to link it again in the loop below.
-    if (!skipPredRemoval)
-    {
-        fgRemoveRefPred(trueEdge);
+        const unsigned caseIdx = static_cast<unsigned>(testValues[testIdx] - minValue);
+        assert(caseIdx < jumpCount);
+        if (caseTargets[caseIdx] == nullptr)
+        {
+            caseTargets[caseIdx] = testTargets[testIdx];
+        }
+        testCases[testIdx] = caseIdx;
     }
 
-    FlowEdge* switchTrueEdge = nullptr;
-
     for (unsigned i = 0; i < jumpCount; i++)
     {
-        // value exists in the testValues array (via bitVector) - 'true' case.
-        const bool isTrue = (bitVector & static_cast<ssize_t>(1ULL << i)) != 0;
-
-        FlowEdge* const newEdge = fgAddRefPred((isTrue ? blockIfTrue : blockIfFalse), firstBlock);
-        jmpTab[i]               = newEdge;
-
-        if ((switchTrueEdge == nullptr) && isTrue)
-        {
-            switchTrueEdge = newEdge;
-        }
+        // Values not tested by the chain go to the 'default' (false) block.
+        BasicBlock* const caseTarget = (caseTargets[i] != nullptr) ? caseTargets[i] : blockIfFalse;
+        jmpTab[i]                    = fgAddRefPred(caseTarget, firstBlock);
     }
 
     // Link the 'default' case
     FlowEdge* const switchDefaultEdge = fgAddRefPred(blockIfFalse, firstBlock);
     jmpTab[jumpCount]                 = switchDefaultEdge;
 
-    // Fix likelihoods
-    switchDefaultEdge->setLikelihood(falseLikelihood);
-    switchTrueEdge->setLikelihood(1.0 - falseLikelihood);
+    // Fix likelihoods. Duplicate entries for the same target share a single edge,
+    // so accumulate the likelihood of every test (and of the default) onto it.
+    for (unsigned i = 0; i <= jumpCount; i++)
+    {
+        jmpTab[i]->setLikelihood(0);
+    }
+
+    for (testIdx = 0; testIdx < testsCount; testIdx++)
+    {
+        jmpTab[testCases[testIdx]]->addLikelihood(testLikelihoods[testIdx]);
+    }
+
+    switchDefaultEdge->addLikelihood(falseLikelihood);
 
     return true;
 }
@@ -443,10 +443,10 @@ ValueNumStore::ValueNumStore(Compiler* comp, CompAllocator alloc)
 #endif // FEATURE_MASKED_HW_INTRINSICS
 #endif // FEATURE_SIMD
     , m_VNFunc0Map(nullptr)
-    , m_VNFunc1Map(nullptr)
-    , m_VNFunc2Map(nullptr)
-    , m_VNFunc3Map(nullptr)
-    , m_VNFunc4Map(nullptr)
+    , m_VNFunc1Map(comp->getAllocator(CMK_ValueNumberFuncApp))
+    , m_VNFunc2Map(comp->getAllocator(CMK_ValueNumberFuncApp))
+    , m_VNFunc3Map(comp->getAllocator(CMK_ValueNumberFuncApp))
+    , m_VNFunc4Map(comp->getAllocator(CMK_ValueNumberFuncApp))
 #ifdef DEBUG
     , m_numMapSels(0)
 #endif
@@ -1650,8 +1650,8 @@ bool ValueNumStore::IsSharedStatic(ValueNum vn)
 
 ValueNumStore::Chunk::Chunk(CompAllocator alloc, ValueNum* pNextBaseVN, var_types typ, ChunkExtraAttribs attribs)
     : m_defs(nullptr)
-    , m_numUsed(0)
     , m_baseVN(*pNextBaseVN)
+    , m_numUsed(0)
     , m_typ(typ)
     , m_attribs(attribs)
 {
@@ -1775,6 +1775,200 @@ ValueNumStore::Chunk* ValueNumStore::GetAllocChunk(var_types typ, ChunkExtraAttr
     return res;
 }
 
+//------------------------------------------------------------------------
+// IsVNFuncAppOf: Check whether a value number was allocated for a given function application.
+//
+// Arguments:
+//   vn      - the value number
+//   funcApp - the function application
+//
+// Return value:
+//   True if "vn" lives in a chunk of arity "NumArgs" functions and is defined as "funcApp";
+//   false otherwise (e.g. if "vn" is a constant "funcApp" was folded to).
+//
+template <size_t NumArgs>
+bool ValueNumStore::IsVNFuncAppOf(ValueNum vn, const VNDefFuncApp<NumArgs>& funcApp)
+{
+    if (isReservedVN(vn) || (GetChunkNum(vn) >= m_chunks.Size()))
+    {
+        return false;
+    }
+
+    Chunk* const c = m_chunks.GetNoExpand(GetChunkNum(vn));
+    if (c->m_attribs != (ChunkExtraAttribs)(CEA_Func0 + NumArgs))
+    {
+        return false;
+    }
+
+    VNDefFuncAppFlexible* const fapp   = c->PointerToFuncApp(ChunkOffset(vn), NumArgs);
+    bool                        result = fapp->m_func == funcApp.m_func;
+    for (size_t i = 0; i < NumArgs; i++)
+    {
+        result = result && (fapp->m_args[i] == funcApp.m_args[i]);
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------
+// VNFuncAppMap::Hash: Compute the hash code of a function application.
+//
+// Arguments:
+//   func - the function
+//   args - the "NumArgs" arguments
+//
+// Return value:
+//   The hash code; its low bits are well mixed, as the table is indexed by them.
+//
+template <size_t NumArgs>
+unsigned ValueNumStore::VNFuncAppMap<NumArgs>::Hash(VNFunc func, const ValueNum* args)
+{
+    unsigned hashCode = func;
+    for (size_t i = 0; i < NumArgs; i++)
+    {
+        hashCode = (hashCode << 8) | (hashCode >> 24);
+        hashCode ^= args[i];
+    }
+
+    hashCode *= 0x9E3779B9;
+    return hashCode ^ (hashCode >> 16);
+}
+
+//------------------------------------------------------------------------
+// VNFuncAppMap::Lookup: Find the value number of a function application.
+//
+// Arguments:
+//   vnStore - the store the function applications were allocated in
+//   key     - the function application
+//   pVal    - [out] the value number, if found
+//
+// Return value:
+//   True if the function application has been recorded.
+//
+template <size_t NumArgs>
+bool ValueNumStore::VNFuncAppMap<NumArgs>::Lookup(ValueNumStore*               vnStore,
+                                                  const VNDefFuncApp<NumArgs>& key,
+                                                  ValueNum*                    pVal) const
+{
+    if (m_tableSize != 0)
+    {
+        unsigned const mask = m_tableSize - 1;
+        for (unsigned index = Hash(key.m_func, key.m_args) & mask;; index = (index + 1) & mask)
+        {
+            ValueNum const vn = m_table[index];
+            if (vn == NoVN)
+            {
+                break;
+            }
+
+            // Everything in the table was allocated in an arity "NumArgs" chunk, see "Set".
+            VNDefFuncAppFlexible* const fapp = vnStore->m_chunks.GetNoExpand(GetChunkNum(vn))
+                                                   ->PointerToFuncApp(ChunkOffset(vn), NumArgs);
+            bool matches = fapp->m_func == key.m_func;
+            for (size_t i = 0; i < NumArgs; i++)
+            {
+                matches = matches && (fapp->m_args[i] == key.m_args[i]);
+            }
+
+            if (matches)
+            {
+                *pVal = vn;
+                return true;
+            }
+        }
+    }
+
+    if ((m_foldedMap != nullptr) && m_foldedMap->Lookup(key, pVal))
+    {
+        return true;
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------
+// VNFuncAppMap::Set: Record the value number of a function application.
+//
+// Arguments:
+//   vnStore - the store the function applications were allocated in
+//   key     - the function application, which must not have been recorded yet
+//   val     - its value number
+//
+template <size_t NumArgs>
+void ValueNumStore::VNFuncAppMap<NumArgs>::Set(ValueNumStore* vnStore, const VNDefFuncApp<NumArgs>& key, ValueNum val)
+{
+    assert(val != RecursiveVN);
+
+    if (!vnStore->IsVNFuncAppOf(val, key))
+    {
+        if (m_foldedMap == nullptr)
+        {
+            m_foldedMap = new (m_alloc) FoldedMap(m_alloc);
+        }
+        m_foldedMap->Set(key, val);
+        return;
+    }
+
+    // Keep the load factor at or below 3/4.
+    if ((m_count + 1) * 4 > m_tableSize * 3)
+    {
+        Grow(vnStore);
+    }
+
+    unsigned const mask  = m_tableSize - 1;
+    unsigned       index = Hash(key.m_func, key.m_args) & mask;
+    while (m_table[index] != NoVN)
+    {
+        assert(m_table[index] != val);
+        index = (index + 1) & mask;
+    }
+
+    m_table[index] = val;
+    m_count++;
+}
+
+//------------------------------------------------------------------------
+// VNFuncAppMap::Grow: Double the size of the table and reinsert its entries.
+//
+// Arguments:
+//   vnStore - the store the function applications were allocated in
+//
+// Notes:
+//   The old table is left to the arena; entries are rehashed from the chunk contents.
+//
+template <size_t NumArgs>
+void ValueNumStore::VNFuncAppMap<NumArgs>::Grow(ValueNumStore* vnStore)
+{
+    unsigned const  oldSize  = m_tableSize;
+    ValueNum* const oldTable = m_table;
+
+    m_tableSize = (oldSize == 0) ? 64 : oldSize * 2;
+    m_table     = m_alloc.allocate<ValueNum>(m_tableSize);
+    for (unsigned i = 0; i < m_tableSize; i++)
+    {
+        m_table[i] = NoVN;
+    }
+
+    unsigned const mask = m_tableSize - 1;
+    for (unsigned i = 0; i < oldSize; i++)
+    {
+        ValueNum const vn = oldTable[i];
+        if (vn == NoVN)
+        {
+            continue;
+        }
+
+        VNDefFuncAppFlexible* const fapp =
+            vnStore->m_chunks.GetNoExpand(GetChunkNum(vn))->PointerToFuncApp(ChunkOffset(vn), NumArgs);
+        unsigned index = Hash(fapp->m_func, fapp->m_args) & mask;
+        while (m_table[index] != NoVN)
+        {
+            index = (index + 1) & mask;
+        }
+        m_table[index] = vn;
+    }
+}
+
 //------------------------------------------------------------------------
 // VnForConst: Return value number for a constant.
 //
@@ -2568,7 +2762,7 @@ ValueNum ValueNumStore::VNForFunc(var_types typ, VNFunc func, ValueNum arg0VN)
     // Have we already assigned a ValueNum for 'func'('arg0VN') ?
     //
     VNDefFuncApp<1> fstruct(func, arg0VN);
-    if (GetVNFunc1Map()->Lookup(fstruct, &resultVN))
+    if (m_VNFunc1Map.Lookup(this, fstruct, &resultVN))
     {
         assert(resultVN != NoVN);
     }
@@ -2652,7 +2846,7 @@ ValueNum ValueNumStore::VNForFunc(var_types typ, VNFunc func, ValueNum arg0VN)
 
         // Record 'resultVN' in the Func1Map
         //
-        GetVNFunc1Map()->Set(fstruct, resultVN);
+        m_VNFunc1Map.Set(this, fstruct, resultVN);
     }
     return resultVN;
 }
@@ -2795,7 +2989,7 @@ ValueNum ValueNumStore::VNForFunc(var_types typ, VNFunc func, ValueNum arg0VN, V
     // Have we already assigned a ValueNum for 'func'('arg0VN','arg1VN') ?
     //
     VNDefFuncApp<2> fstruct(func, arg0VN, arg1VN);
-    if (GetVNFunc2Map()->Lookup(fstruct, &resultVN))
+    if (m_VNFunc2Map.Lookup(this, fstruct, &resultVN))
     {
         assert(resultVN != NoVN);
     }
@@ -2842,7 +3036,7 @@ ValueNum ValueNumStore::VNForFunc(var_types typ, VNFunc func, ValueNum arg0VN, V
         }
 
         // Record 'resultVN' in the Func2Map
-        GetVNFunc2Map()->Set(fstruct, resultVN);
+        m_VNFunc2Map.Set(this, fstruct, resultVN);
     }
     return resultVN;
 }
@@ -2873,7 +3067,7 @@ ValueNum ValueNumStore::VNForFuncNoFolding(var_types typ, VNFunc func, ValueNum
     // Have we already assigned a ValueNum for 'func'('arg0VN','arg1VN') ?
     //
     VNDefFuncApp<2> fstruct(func, arg0VN, arg1VN);
-    if (!GetVNFunc2Map()->Lookup(fstruct, &resultVN))
+    if (!m_VNFunc2Map.Lookup(this, fstruct, &resultVN))
     {
         // Otherwise, Allocate a new ValueNum for 'func'('arg0VN','arg1VN')
         //
@@ -2886,7 +3080,7 @@ ValueNum ValueNumStore::VNForFuncNoFolding(var_types typ, VNFunc func, ValueNum
         resultVN                                = c->m_baseVN + offsetWithinChunk;
 
         // Record 'resultVN' in the Func2Map
-        GetVNFunc2Map()->Set(fstruct, resultVN);
+        m_VNFunc2Map.Set(this, fstruct, resultVN);
     }
 
     return resultVN;
@@ -2937,7 +3131,7 @@ ValueNum ValueNumStore::VNForFunc(var_types typ, VNFunc func, ValueNum arg0VN, V
     // Have we already assigned a ValueNum for 'func'('arg0VN','arg1VN','arg2VN') ?
     //
     VNDefFuncApp<3> fstruct(func, arg0VN, arg1VN, arg2VN);
-    if (!GetVNFunc3Map()->Lookup(fstruct, &resultVN))
+    if (!m_VNFunc3Map.Lookup(this, fstruct, &resultVN))
     {
         // Otherwise, Allocate a new ValueNum for 'func'('arg0VN','arg1VN','arg2VN')
         //
@@ -2951,7 +3145,7 @@ ValueNum ValueNumStore::VNForFunc(var_types typ, VNFunc func, ValueNum arg0VN, V
         resultVN                                = c->m_baseVN + offsetWithinChunk;
 
         // Record 'resultVN' in the Func3Map
-        GetVNFunc3Map()->Set(fstruct, resultVN);
+        m_VNFunc3Map.Set(this, fstruct, resultVN);
     }
     return resultVN;
 }
@@ -2990,7 +3184,7 @@ ValueNum ValueNumStore::VNForFunc(
     // Have we already assigned a ValueNum for 'func'('arg0VN','arg1VN','arg2VN','arg3VN') ?
     //
     VNDefFuncApp<4> fstruct(func, arg0VN, arg1VN, arg2VN, arg3VN);
-    if (!GetVNFunc4Map()->Lookup(fstruct, &resultVN))
+    if (!m_VNFunc4Map.Lookup(this, fstruct, &resultVN))
     {
         // Otherwise, Allocate a new ValueNum for 'func'('arg0VN','arg1VN','arg2VN','arg3VN')
         //
@@ -3005,7 +3199,7 @@ ValueNum ValueNumStore::VNForFunc(
         resultVN                                = c->m_baseVN + offsetWithinChunk;
 
         // Record 'resultVN' in the Func4Map
-        GetVNFunc4Map()->Set(fstruct, resultVN);
+        m_VNFunc4Map.Set(this, fstruct, resultVN);
     }
     return resultVN;
 }
@@ -1366,6 +1366,7 @@ private:
     static const unsigned LogChunkSize    = 6;
     static const unsigned ChunkSize       = 1 << LogChunkSize;
     static const unsigned ChunkOffsetMask = ChunkSize - 1;
+    static_assert_no_msg(ChunkSize <= UINT8_MAX);
 
     // A "ChunkNum" is a zero-based index naming a chunk in the Store, or else the special "NoChunk" value.
     typedef UINT32        ChunkNum;
@@ -1406,12 +1407,14 @@ private:
         // If "m_defs" is non-null, it is an array of size ChunkSize, whose element type is determined by the other
         // members. The "m_numUsed" field indicates the number of elements of "m_defs" that are already consumed (the
         // next one to allocate).
-        void*    m_defs;
-        unsigned m_numUsed;
+        void* m_defs;
 
         // The value number of the first VN in the chunk.
         ValueNum m_baseVN;
 
+        // Kept narrow (together with the attributes below) so that the chunk header fits in 16 bytes.
+        uint8_t m_numUsed;
+
         // The common attributes of this chunk.
         var_types         m_typ;
         ChunkExtraAttribs m_attribs;
@@ -1844,49 +1847,50 @@ private:
         return m_VNFunc0Map;
     }
 
-    typedef VNMap<VNDefFuncApp<1>, VNDefFuncAppKeyFuncs<1>> VNFunc1ToValueNumMap;
-    VNFunc1ToValueNumMap*                                   m_VNFunc1Map;
-    VNFunc1ToValueNumMap*                                   GetVNFunc1Map()
+    // A map from applications of functions of arity "NumArgs" to their value numbers.
+    //
+    // Most entries map a function application to the VN that was allocated for it, and the chunk
+    // of that VN already records the function and its arguments. These entries are kept in a flat,
+    // open-addressed table of bare ValueNums and compared against the chunk contents, so the key is
+    // not stored a second time and no per-entry nodes are allocated. The remaining entries, whose
+    // value is the (differently defined) result of folding, are kept in an ordinary VNMap.
+    template <size_t NumArgs>
+    class VNFuncAppMap
     {
-        if (m_VNFunc1Map == nullptr)
-        {
-            m_VNFunc1Map = new (m_alloc) VNFunc1ToValueNumMap(m_alloc);
-        }
-        return m_VNFunc1Map;
-    }
+        typedef VNMap<VNDefFuncApp<NumArgs>, VNDefFuncAppKeyFuncs<NumArgs>> FoldedMap;
 
-    typedef VNMap<VNDefFuncApp<2>, VNDefFuncAppKeyFuncs<2>> VNFunc2ToValueNumMap;
-    VNFunc2ToValueNumMap*                                   m_VNFunc2Map;
-    VNFunc2ToValueNumMap*                                   GetVNFunc2Map()
-    {
-        if (m_VNFunc2Map == nullptr)
-        {
-            m_VNFunc2Map = new (m_alloc) VNFunc2ToValueNumMap(m_alloc);
-        }
-        return m_VNFunc2Map;
-    }
+        CompAllocator m_alloc;
+        ValueNum*     m_table;     // NoVN denotes an empty slot.
+        unsigned      m_tableSize; // Zero, or a power of two.
+        unsigned      m_count;
+        FoldedMap*    m_foldedMap;
 
-    typedef VNMap<VNDefFuncApp<3>, VNDefFuncAppKeyFuncs<3>> VNFunc3ToValueNumMap;
-    VNFunc3ToValueNumMap*                                   m_VNFunc3Map;
-    VNFunc3ToValueNumMap*                                   GetVNFunc3Map()
-    {
-        if (m_VNFunc3Map == nullptr)
-        {
-            m_VNFunc3Map = new (m_alloc) VNFunc3ToValueNumMap(m_alloc);
-        }
-        return m_VNFunc3Map;
-    }
+        static unsigned Hash(VNFunc func, const ValueNum* args);
+        void            Grow(ValueNumStore* vnStore);
 
-    typedef VNMap<VNDefFuncApp<4>, VNDefFuncAppKeyFuncs<4>> VNFunc4ToValueNumMap;
-    VNFunc4ToValueNumMap*                                   m_VNFunc4Map;
-    VNFunc4ToValueNumMap*                                   GetVNFunc4Map()
-    {
-        if (m_VNFunc4Map == nullptr)
+    public:
+        VNFuncAppMap(CompAllocator alloc)
+            : m_alloc(alloc)
+            , m_table(nullptr)
+            , m_tableSize(0)
+            , m_count(0)
+            , m_foldedMap(nullptr)
         {
-            m_VNFunc4Map = new (m_alloc) VNFunc4ToValueNumMap(m_alloc);
         }
-        return m_VNFunc4Map;
-    }
+
+        bool Lookup(ValueNumStore* vnStore, const VNDefFuncApp<NumArgs>& key, ValueNum* pVal) const;
+        void Set(ValueNumStore* vnStore, const VNDefFuncApp<NumArgs>& key, ValueNum val);
+    };
+
+    // Returns true if "vn" was allocated in a chunk of arity "NumArgs" functions for exactly "funcApp".
+    template <size_t NumArgs>
+    bool IsVNFuncAppOf(ValueNum vn, const VNDefFuncApp<NumArgs>& funcApp);
+
+    // Memory for these is accounted as CMK_ValueNumberFuncApp.
+    VNFuncAppMap<1> m_VNFunc1Map;
+    VNFuncAppMap<2> m_VNFunc2Map;
+    VNFuncAppMap<3> m_VNFunc3Map;
+    VNFuncAppMap<4> m_VNFunc4Map;
 
     class MapSelectWorkCacheEntry
     {
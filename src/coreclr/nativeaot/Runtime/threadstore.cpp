@@ -128,6 +128,16 @@ void ThreadStore::AttachCurrentThread(bool fAcquireThreadStoreLock)
     pAttachingThread->Construct();
     ASSERT(pAttachingThread->m_ThreadStateFlags == Thread::TSF_Unknown);
 
+#ifdef TARGET_UNIX
+    // Managed threads, including thread pool workers, attach here the first time they run managed
+    // code. GC threads attach with the lock already held during a GC and apply their heap affinity
+    // afterwards, so their stacks are left alone.
+    if (fAcquireThreadStoreLock)
+    {
+        PalPrefaultCurrentThreadStack();
+    }
+#endif
+
     // fAcquireThreadStoreLock is false when threads are created/attached for GC purpose
     // in such case the lock is already held and GC takes care to ensure safe access to the threadstore
 
@@ -384,6 +384,7 @@ void InitializeCurrentProcessCpuCount()
 }
 
 static uint32_t g_RhPageSize;
+static size_t g_RhPrefaultThreadStackSize;
 
 void InitializeOsPageSize()
 {
@@ -436,6 +437,8 @@ REDHAWK_PALEXPORT bool REDHAWK_PALAPI PalInit()
 
     InitializeOsPageSize();
 
+    g_RhPrefaultThreadStackSize = (size_t)g_pRhConfig->GetPrefaultThreadStack();
+
 #if defined(TARGET_LINUX) || defined(TARGET_ANDROID)
     if (pthread_key_create(&key, RuntimeThreadShutdown) != 0)
     {
@@ -658,6 +661,46 @@ REDHAWK_PALEXPORT HANDLE REDHAWK_PALAPI PalCreateEventW(_In_opt_ LPSECURITY_ATTR
     return handle;
 }
 
+// Touches each page of the next PrefaultThreadStack bytes of the current thread's stack, so that
+// the pages are committed when the thread attaches to the runtime instead of being faulted in lazily
+// while it serves its first requests. The pages are touched through an alloca'd block, so a signal
+// handler running on this thread in the meantime cannot have its frame overwritten.
+REDHAWK_PALEXPORT NOINLINE void REDHAWK_PALAPI PalPrefaultCurrentThreadStack()
+{
+    size_t size = g_RhPrefaultThreadStackSize;
+    if (size == 0)
+    {
+        return;
+    }
+
+    void* pStackLow;
+    void* pStackHigh;
+    if (!PalGetMaximumStackBounds(&pStackLow, &pStackHigh))
+    {
+        return;
+    }
+
+    // Stay well clear of the guard page at the bottom of the stack.
+    uint8_t marker;
+    uintptr_t available = (uintptr_t)&marker - (uintptr_t)pStackLow;
+    uintptr_t reserve = 16 * (uintptr_t)g_RhPageSize;
+    if (available <= reserve)
+    {
+        return;
+    }
+
+    if (size > available - reserve)
+    {
+        size = available - reserve;
+    }
+
+    volatile uint8_t* pBlock = (volatile uint8_t*)__builtin_alloca(size);
+    for (size_t offset = size; offset >= g_RhPageSize; offset -= g_RhPageSize)
+    {
+        pBlock[offset - 1] = 0;
+    }
+}
+
 typedef uint32_t(__stdcall *BackgroundCallback)(_In_opt_ void* pCallbackContext);
 
 REDHAWK_PALEXPORT bool REDHAWK_PALAPI PalStartBackgroundWork(_In_ BackgroundCallback callback, _In_opt_ void* pCallbackContext, UInt32_BOOL highPriority)
@@ -53,6 +53,13 @@ CRITICAL_SECTION virtual_critsec;
 // The first node in our list of allocated blocks.
 static PCMI pVirtualMemory;
 
+// The entries of the list above, sorted by startBoundary. Lookups and insertions
+// binary search this array instead of walking the list, so that they stay cheap
+// when the process has many thousands of reservations.
+static PCMI *pVirtualMemoryIndex;
+static SIZE_T virtualMemoryIndexCount;
+static SIZE_T virtualMemoryIndexCapacity;
+
 static size_t s_virtualPageSize = 0;
 
 /* We need MAP_ANON. However on some platforms like HP-UX, it is defined as MAP_ANONYMOUS */
@@ -173,6 +180,9 @@ VIRTUALInitialize(bool initializeExecutableMemoryAllocator)
     InternalInitializeCriticalSection(&virtual_critsec);
 
     pVirtualMemory = NULL;
+    pVirtualMemoryIndex = NULL;
+    virtualMemoryIndexCount = 0;
+    virtualMemoryIndexCapacity = 0;
 
     if (initializeExecutableMemoryAllocator)
     {
@@ -209,6 +219,11 @@ void VIRTUALCleanup()
     }
     pVirtualMemory = NULL;
 
+    free(pVirtualMemoryIndex);
+    pVirtualMemoryIndex = NULL;
+    virtualMemoryIndexCount = 0;
+    virtualMemoryIndexCapacity = 0;
+
     InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
 
     TRACE( "Deleting the Virtual Critical Sections. \n" );
@@ -235,6 +250,35 @@ static BOOL VIRTUALContainsInvalidProtectionFlags( IN DWORD flProtect )
 }
 
 
+/****
+ *
+ * VIRTUALIndexLowerBound( )
+ *
+ *          IN UINT_PTR address - The address to look for.
+ *
+ *          Returns the number of entries in the index that start below address.
+ *          NOTE: The caller must own the critical section.
+ */
+static SIZE_T VIRTUALIndexLowerBound( IN UINT_PTR address )
+{
+    SIZE_T low = 0;
+    SIZE_T high = virtualMemoryIndexCount;
+
+    while ( low < high )
+    {
+        SIZE_T mid = low + (high - low) / 2;
+        if ( pVirtualMemoryIndex[mid]->startBoundary < address )
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return low;
+}
+
 /****
  *
  * VIRTUALFindRegionInformation( )
@@ -249,22 +293,21 @@ static PCMI VIRTUALFindRegionInformation( IN UINT_PTR address )
 
     TRACE( "VIRTUALFindRegionInformation( %#x )\n", address );
 
-    pEntry = pVirtualMemory;
+    SIZE_T index = VIRTUALIndexLowerBound( address );
 
-    while( pEntry )
+    if ( index < virtualMemoryIndexCount &&
+         pVirtualMemoryIndex[index]->startBoundary == address )
     {
-        if ( pEntry->startBoundary > address )
+        pEntry = pVirtualMemoryIndex[index];
+    }
+    else if ( index > 0 )
+    {
+        /* The only candidate is the last region starting below the address. */
+        pEntry = pVirtualMemoryIndex[index - 1];
+        if ( pEntry->startBoundary + pEntry->memSize <= address )
         {
-            /* Gone past the possible location in the list. */
             pEntry = NULL;
-            break;
-        }
-        if ( pEntry->startBoundary + pEntry->memSize > address )
-        {
-            break;
         }
-
-        pEntry = pEntry->pNext;
     }
     return pEntry;
 }
@@ -288,6 +331,17 @@ static BOOL VIRTUALReleaseMemory( PCMI pMemoryToBeReleased )
         return FALSE;
     }
 
+    /* Remove the entry from the index. */
+    SIZE_T index = VIRTUALIndexLowerBound( pMemoryToBeReleased->startBoundary );
+    while ( index < virtualMemoryIndexCount && pVirtualMemoryIndex[index] != pMemoryToBeReleased )
+    {
+        index++;
+    }
+    _ASSERTE( index < virtualMemoryIndexCount );
+    memmove( &pVirtualMemoryIndex[index], &pVirtualMemoryIndex[index + 1],
+             (virtualMemoryIndexCount - index - 1) * sizeof(PCMI) );
+    virtualMemoryIndexCount--;
+
     if ( pMemoryToBeReleased == pVirtualMemory )
     {
         /* This is either the first entry, or the only entry. */
@@ -393,7 +447,6 @@ static BOOL VIRTUALStoreAllocationInfo(
 {
     PCMI pNewEntry       = nullptr;
     PCMI pMemInfo        = nullptr;
-    SIZE_T nBufferSize   = 0;
 
     if (!IS_ALIGNED(memSize, GetVirtualPageSize()))
     {
@@ -401,6 +454,20 @@ static BOOL VIRTUALStoreAllocationInfo(
         return FALSE;
     }
 
+    if (virtualMemoryIndexCount == virtualMemoryIndexCapacity)
+    {
+        SIZE_T newCapacity = (virtualMemoryIndexCapacity == 0) ? 64 : virtualMemoryIndexCapacity * 2;
+        PCMI *pNewIndex = (PCMI *)realloc(pVirtualMemoryIndex, newCapacity * sizeof(PCMI));
+        if (pNewIndex == nullptr)
+        {
+            ERROR( "Unable to grow the region index.\n");
+            return FALSE;
+        }
+
+        pVirtualMemoryIndex = pNewIndex;
+        virtualMemoryIndexCapacity = newCapacity;
+    }
+
     if (!(pNewEntry = (PCMI)malloc(sizeof(*pNewEntry))))
     {
         ERROR( "Unable to allocate memory for the structure.\n");
@@ -412,17 +479,17 @@ static BOOL VIRTUALStoreAllocationInfo(
     pNewEntry->allocationType   = flAllocationType;
     pNewEntry->accessProtection = flProtection;
 
-    pMemInfo = pVirtualMemory;
+    /* Find the insert point in the index; the list entry before it is the one to link after. */
+    SIZE_T index = VIRTUALIndexLowerBound(startBoundary);
+    memmove(&pVirtualMemoryIndex[index + 1], &pVirtualMemoryIndex[index],
+            (virtualMemoryIndexCount - index) * sizeof(PCMI));
+    pVirtualMemoryIndex[index] = pNewEntry;
+    virtualMemoryIndexCount++;
 
-    if (pMemInfo && pMemInfo->startBoundary < startBoundary)
-    {
-        /* Look for the correct insert point */
-        TRACE("Looking for the correct insert location.\n");
-        while (pMemInfo->pNext && (pMemInfo->pNext->startBoundary < startBoundary))
-        {
-            pMemInfo = pMemInfo->pNext;
-        }
+    pMemInfo = (index > 0) ? pVirtualMemoryIndex[index - 1] : nullptr;
 
+    if (pMemInfo)
+    {
         pNewEntry->pNext = pMemInfo->pNext;
         pNewEntry->pPrevious = pMemInfo;
 
@@ -436,7 +503,7 @@ static BOOL VIRTUALStoreAllocationInfo(
     else
     {
         /* This is the first entry in the list. */
-        pNewEntry->pNext = pMemInfo;
+        pNewEntry->pNext = pVirtualMemory;
         pNewEntry->pPrevious = nullptr;
 
         if (pNewEntry->pNext)
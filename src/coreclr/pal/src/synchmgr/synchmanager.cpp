@@ -41,6 +41,11 @@ SET_DEFAULT_DEBUG_CHANNEL(SYNC); // some headers have code with asserts, so do t
 
 #include <algorithm>
 
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
+
 const int CorUnix::CThreadSynchronizationInfo::PendingSignalingsArraySize;
 
 // We use the synchronization manager's worker thread to handle
@@ -184,6 +189,69 @@ namespace CorUnix
     {
     }
 
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+    /*++
+    Method:
+      CPalSynchronizationManager::FutexNativeWait
+
+    Futex based equivalent of the predicate/condition wait performed by
+    ThreadNativeWait. The predicate word is FALSE while no wakeup is pending,
+    TRUE once the thread has been signaled and NativeWaitPredParked while the
+    thread is (about to be) blocked in the kernel, so that the signaling side
+    knows whether a FUTEX_WAKE is required.
+
+    Returns 0 on wakeup, ETIMEDOUT on timeout or another errno value on failure.
+    --*/
+    int CPalSynchronizationManager::FutexNativeWait(
+        ThreadNativeWaitData * ptnwdNativeWaitData,
+        const struct timespec * ptsAbsTmo)
+    {
+        int * piPred = &ptnwdNativeWaitData->iPred;
+        int iPred = __atomic_load_n(piPred, __ATOMIC_ACQUIRE);
+
+        while (TRUE != iPred)
+        {
+            if (FALSE == iPred &&
+                !__atomic_compare_exchange_n(piPred, &iPred, NativeWaitPredParked,
+                                             false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+            {
+                // Got signaled meanwhile, iPred has been refreshed
+                continue;
+            }
+
+            // FUTEX_WAIT_BITSET takes an absolute timeout on CLOCK_MONOTONIC,
+            // which is what GetAbsoluteTimeout returns on this platform
+            if (-1 == syscall(SYS_futex, piPred, FUTEX_WAIT_BITSET_PRIVATE,
+                              NativeWaitPredParked, ptsAbsTmo, NULL,
+                              FUTEX_BITSET_MATCH_ANY))
+            {
+                int iErr = errno;
+                if (ETIMEDOUT == iErr)
+                {
+                    // Withdraw the parked state. If a signal raced with the
+                    // timeout the predicate stays TRUE, to be picked up by the
+                    // 'second native wait' (see comments in BlockThread), just
+                    // like with pthread_cond_timedwait.
+                    int iExpected = NativeWaitPredParked;
+                    __atomic_compare_exchange_n(piPred, &iExpected, FALSE,
+                                                false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+                    return ETIMEDOUT;
+                }
+                else if (EAGAIN != iErr && EINTR != iErr)
+                {
+                    return iErr;
+                }
+            }
+
+            iPred = __atomic_load_n(piPred, __ATOMIC_ACQUIRE);
+        }
+
+        // Reset the predicate
+        __atomic_store_n(piPred, FALSE, __ATOMIC_RELAXED);
+        return 0;
+    }
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
+
     /*++
     Method:
       CPalSynchronizationManager::BlockThread
@@ -445,7 +513,7 @@ namespace CorUnix
         DWORD * pdwSignaledObject)
     {
         PAL_ERROR palErr = NO_ERROR;
-        int iRet, iWaitRet = 0;
+        int iRet = 0, iWaitRet = 0;
         struct timespec tsAbsTmo;
 
         TRACE("ThreadNativeWait(ptnwdNativeWaitData=%p, dwTimeout=%u, ...)\n",
@@ -462,6 +530,16 @@ namespace CorUnix
             }
         }
 
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+        iWaitRet = FutexNativeWait(ptnwdNativeWaitData,
+                                   (INFINITE == dwTimeout) ? NULL : &tsAbsTmo);
+        if (0 != iWaitRet && ETIMEDOUT != iWaitRet)
+        {
+            ERROR("futex wait failed [errno=%d (%s)]\n",
+                  iWaitRet, strerror(iWaitRet));
+            palErr = ERROR_INTERNAL_ERROR;
+        }
+#else // SYNCHMGR_FUTEX_NATIVE_WAIT
         // Lock the mutex
         iRet = pthread_mutex_lock(&ptnwdNativeWaitData->mutex);
         if (0 != iRet)
@@ -530,6 +608,7 @@ namespace CorUnix
             palErr = ERROR_INTERNAL_ERROR;
             goto TNW_exit;
         }
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
 
         _ASSERT_MSG(ETIMEDOUT != iRet || INFINITE != dwTimeout, "Got timeout return code with INFINITE timeout\n");
 
@@ -2480,6 +2559,24 @@ namespace CorUnix
         PAL_ERROR palErr = NO_ERROR;
         int iRet;
 
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+        // Set the predicate; the release semantics publish the wakeup reason
+        // and object index stored by the caller. A system call is needed only
+        // if the target thread already parked itself in the kernel.
+        iRet = __atomic_exchange_n(&ptnwdNativeWaitData->iPred, TRUE, __ATOMIC_ACQ_REL);
+        if (NativeWaitPredParked == iRet)
+        {
+            if (-1 == syscall(SYS_futex, &ptnwdNativeWaitData->iPred,
+                              FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0))
+            {
+                ERROR("Failed to wake up thread: futex returned "
+                      "[errno=%d (%s)]\n", errno, strerror(errno));
+                palErr = ERROR_INTERNAL_ERROR;
+            }
+        }
+
+        return palErr;
+#else // SYNCHMGR_FUTEX_NATIVE_WAIT
         // Lock the mutex
         iRet = pthread_mutex_lock(&ptnwdNativeWaitData->mutex);
         if (0 != iRet)
@@ -2511,6 +2608,7 @@ namespace CorUnix
         }
 
         return palErr;
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
     }
 
     /*++
@@ -46,6 +46,14 @@ Abstract:
 #define VALIDATEOBJECT(obj)
 #endif
 
+#if defined(__linux__) && HAVE_CLOCK_MONOTONIC && HAVE_PTHREAD_CONDATTR_SETCLOCK
+// Local thread waits park on the native wait predicate with a futex instead
+// of going through the per-thread mutex and condition: signaling a thread
+// then costs one atomic exchange, plus a FUTEX_WAKE only when the target is
+// actually blocked, and never contends with the waiter on a mutex.
+#define SYNCHMGR_FUTEX_NATIVE_WAIT 1
+#endif
+
 namespace CorUnix
 {
     const DWORD WTLN_FLAG_OWNER_OBJECT_IS_SHARED                 = 1<<0;
@@ -941,6 +949,14 @@ namespace CorUnix
             ThreadWakeupReason * ptwrWakeupReason,
             DWORD * pdwSignaledObject);
 
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+        static const int NativeWaitPredParked = 2;
+
+        static int FutexNativeWait(
+            ThreadNativeWaitData * ptnwdNativeWaitData,
+            const struct timespec * ptsAbsTmo);
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
+
         static void ThreadPrepareForShutdown(void);
 
 #ifndef CORECLR
@@ -70,6 +70,9 @@ MethodContextReader::MethodContextReader(
     const char* inputFileName, const int* indexes, int indexCount, char* hash, int offset, int increment)
     : fileHandle(INVALID_HANDLE_VALUE)
     , fileSize(0)
+    , fileMapping(NULL)
+    , fileView(nullptr)
+    , viewPos(0)
     , curMCIndex(0)
     , Indexes(indexes)
     , IndexCount(indexCount)
@@ -113,6 +116,7 @@ MethodContextReader::MethodContextReader(
     if (this->fileHandle != INVALID_HANDLE_VALUE)
     {
         GetFileSizeEx(this->fileHandle, (PLARGE_INTEGER) & this->fileSize);
+        MapFile();
     }
 
     ReadExcludedMethods(mchFileName);
@@ -120,6 +124,8 @@ MethodContextReader::MethodContextReader(
 
 MethodContextReader::~MethodContextReader()
 {
+    UnmapFile();
+
     if (fileHandle != INVALID_HANDLE_VALUE)
     {
         CloseHandle(this->fileHandle);
@@ -141,12 +147,78 @@ void MethodContextReader::ReleaseLock()
     ReleaseMutex(this->mutex);
 }
 
-bool MethodContextReader::atEof()
+void MethodContextReader::MapFile()
+{
+    // Empty files can't be mapped, and on 32-bit hosts the collection may not fit the address space.
+    // Either way we just keep using file I/O.
+    if ((this->fileSize == 0) || ((uint64_t)this->fileSize > SIZE_MAX))
+    {
+        return;
+    }
+
+    this->fileMapping = CreateFileMapping(this->fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (this->fileMapping == NULL)
+    {
+        LogDebug("CreateFileMapping failed, falling back to file I/O. GetLastError()=%u", GetLastError());
+        return;
+    }
+
+    this->fileView = (const unsigned char*)MapViewOfFile(this->fileMapping, FILE_MAP_READ, 0, 0, 0);
+    if (this->fileView == nullptr)
+    {
+        LogDebug("MapViewOfFile failed, falling back to file I/O. GetLastError()=%u", GetLastError());
+        CloseHandle(this->fileMapping);
+        this->fileMapping = NULL;
+    }
+}
+
+void MethodContextReader::UnmapFile()
 {
+    if (this->fileView != nullptr)
+    {
+        UnmapViewOfFile(this->fileView);
+        this->fileView = nullptr;
+    }
+
+    if (this->fileMapping != NULL)
+    {
+        CloseHandle(this->fileMapping);
+        this->fileMapping = NULL;
+    }
+}
+
+int64_t MethodContextReader::GetPosition()
+{
+    if (this->fileView != nullptr)
+    {
+        return this->viewPos;
+    }
+
     int64_t pos = 0;
     SetFilePointerEx(this->fileHandle, *(PLARGE_INTEGER)&pos, (PLARGE_INTEGER)&pos,
                      FILE_CURRENT); // LARGE_INTEGER is a crime against humanity
-    return pos == this->fileSize;
+    return pos;
+}
+
+bool MethodContextReader::SetPosition(int64_t pos)
+{
+    if (this->fileView != nullptr)
+    {
+        if ((pos < 0) || (pos > this->fileSize))
+        {
+            return false;
+        }
+
+        this->viewPos = pos;
+        return true;
+    }
+
+    return SetFilePointerEx(this->fileHandle, *(PLARGE_INTEGER)&pos, NULL, FILE_BEGIN) == TRUE;
+}
+
+bool MethodContextReader::atEof()
+{
+    return GetPosition() == this->fileSize;
 }
 
 MethodContextBuffer MethodContextReader::ReadMethodContextNoLock(bool justSkip)
@@ -158,6 +230,33 @@ MethodContextBuffer MethodContextReader::ReadMethodContextNoLock(bool justSkip)
     {
         return MethodContextBuffer();
     }
+
+    if (this->fileView != nullptr)
+    {
+        const unsigned char* header = this->fileView + this->viewPos;
+        AssertMsg(this->fileSize - this->viewPos >= (int64_t)(2 + sizeof(unsigned int)), "Truncated method context header");
+        AssertMsg((header[0] == 'm') && (header[1] == 'c'), "Didn't find magic number");
+        memcpy(&totalLen, &header[2], sizeof(unsigned int));
+
+        int64_t nextPos = this->viewPos + 2 + sizeof(unsigned int) + (int64_t)totalLen + 2;
+        AssertMsg(nextPos <= this->fileSize, "Truncated method context");
+
+        MethodContextBuffer mcb(0);
+        if (!justSkip)
+        {
+            unsigned char* buff2 = new unsigned char[totalLen + 2]; // total + End Canary
+            memcpy(buff2, header + 2 + sizeof(unsigned int), totalLen + 2);
+            mcb = MethodContextBuffer(buff2, totalLen);
+        }
+
+        this->viewPos = nextPos;
+
+        // Increment curMCIndex as we read (or skipped over) another MC
+        ++curMCIndex;
+
+        return mcb;
+    }
+
     Assert(ReadFile(this->fileHandle, buff, 2 + sizeof(unsigned int), &bytesRead, NULL) == TRUE);
     AssertMsg((buff[0] == 'm') && (buff[1] == 'c'), "Didn't find magic number");
     memcpy(&totalLen, &buff[2], sizeof(unsigned int));
@@ -424,8 +523,7 @@ double MethodContextReader::Progress()
     else
     {
         this->AcquireLock();
-        int64_t pos = 0;
-        SetFilePointerEx(this->fileHandle, *(PLARGE_INTEGER)&pos, (PLARGE_INTEGER)&pos, FILE_CURRENT);
+        int64_t pos = GetPosition();
         this->ReleaseLock();
         return (double)pos;
     }
@@ -498,7 +596,7 @@ MethodContextBuffer MethodContextReader::GetSpecificMethodContext(unsigned int m
     {
         return MethodContextBuffer(-2);
     }
-    if (SetFilePointerEx(this->fileHandle, *(PLARGE_INTEGER)&pos, (PLARGE_INTEGER)&pos, FILE_BEGIN))
+    if (SetPosition(pos))
     {
         // ReadMethodContext will release the lock, but we already acquired it
         MethodContextBuffer mcb = this->ReadMethodContext(false);
@@ -622,8 +720,7 @@ bool MethodContextReader::IsMethodExcluded(MethodContext* mc)
 
 void MethodContextReader::Reset(const int* newIndexes, int newIndexCount)
 {
-    int64_t pos    = 0;
-    BOOL    result = SetFilePointerEx(fileHandle, *(PLARGE_INTEGER)&pos, NULL, FILE_BEGIN);
+    bool result = SetPosition(0);
     assert(result);
     
     Indexes     = newIndexes;
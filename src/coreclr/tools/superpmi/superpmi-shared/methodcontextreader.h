@@ -52,6 +52,13 @@ private:
     // The size of the MC/MCH file
     int64_t fileSize;
 
+    // Read-only view of the whole MC/MCH file, if it could be mapped. Reading
+    // and skipping method contexts is then a copy or a pointer bump instead of
+    // file I/O; otherwise the file is read through fileHandle.
+    HANDLE               fileMapping;
+    const unsigned char* fileView;
+    int64_t              viewPos;
+
     // Current MC index in the input MC/MCH file
     int curMCIndex;
 
@@ -95,6 +102,13 @@ private:
     // Just a helper...
     static HANDLE OpenFile(const char* inputFile, DWORD flags = FILE_ATTRIBUTE_NORMAL);
 
+    void MapFile();
+    void UnmapFile();
+
+    // Current read position in the MC/MCH file
+    int64_t GetPosition();
+    bool    SetPosition(int64_t pos);
+
     MethodContextBuffer ReadMethodContextNoLock(bool justSkip = false);
     MethodContextBuffer ReadMethodContext(bool acquireLock, bool justSkip = false);
     MethodContextBuffer GetSpecificMethodContext(unsigned int methodNumber);
@@ -114,6 +114,8 @@ void CommandLine::DumpHelp(const char* program)
     printf("     Streaming mode. Read and execute work requests from indicated file (can be 'stdin').\n");
     printf("     Each line is a method context number and additional force jit options for that method.\n");
     printf("     Blank line or EOF terminates\n");
+    printf("     Each request is answered with a '[streaming] Done. Status=<result> Size=<code bytes>\n");
+    printf("     Milliseconds=<compile time> Instructions=<count>' line on stdout.\n");
     printf("\n");
     printf(" -failureLimit <limit>\n");
     printf("     For a positive 'limit' number, replay and asm diffs will exit if it sees more than 'limit' failures.\n");
@@ -122,6 +124,12 @@ void CommandLine::DumpHelp(const char* program)
     printf(" -skipCleanup\n");
     printf("     Skip deletion of temporary files created by child SuperPMI processes with -parallel.\n");
     printf("\n");
+    printf(" -perfCounters\n");
+    printf("     Measure instructions retired, cycles and cache misses of each compilation with hardware\n");
+    printf("     performance counters (Linux only). The counts are reported in the -details file. With two\n");
+    printf("     JITs, a summary of the relative difference with 95%% confidence intervals is printed.\n");
+    printf("     With -parallel, each worker is pinned to its own processor.\n");
+    printf("\n");
     printf(" -repeatCount <repetition count>\n");
     printf("     Number of times compilation should repeat for each method context. Usually used when\n");
     printf("     trying to measure JIT throughput for a specific set of methods. Default=1.\n");
@@ -546,6 +554,10 @@ bool CommandLine::Parse(int argc, char* argv[], /* OUT */ Options* o)
             {
                 o->skipCleanup = true;
             }
+            else if ((_stricmp(&argv[i][1], "perfCounters") == 0))
+            {
+                o->perfCounters = true;
+            }
             else if ((_stricmp(&argv[i][1], "repeatCount") == 0))
             {
                 if (++i >= argc)
@@ -25,6 +25,7 @@ public:
         bool  ignoreStoredConfig = false;
         bool  applyDiff = false;
         bool  parallel = false;        // User specified to use /parallel mode.
+        bool  perfCounters = false;    // Collect hardware performance counters for each compilation.
         char* streamFile = nullptr;
 #if !defined(USE_MSVCDIS) && defined(USE_COREDISTOOLS)
         bool  useCoreDisTools = true; // Use CoreDisTools library instead of Msvcdis
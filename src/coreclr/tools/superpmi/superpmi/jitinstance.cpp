@@ -326,6 +326,11 @@ ReplayResults JitInstance::CompileMethod(MethodContext* MethodToCompile, int mcI
     UINT64 insCountBefore = 0;
     Instrumentor_GetInsCount(&insCountBefore);
 
+    if (perfCounters != nullptr)
+    {
+        perfCounters->Start();
+    }
+
     PAL_TRY(Param*, pParam, &param)
     {
         uint8_t*   NEntryBlock    = nullptr;
@@ -452,6 +457,11 @@ ReplayResults JitInstance::CompileMethod(MethodContext* MethodToCompile, int mcI
     PAL_ENDTRY
 
     stj.Stop();
+    if (perfCounters != nullptr)
+    {
+        param.results.Counters = perfCounters->Stop();
+    }
+
     if (collectThroughput)
     {
         // If we get here, we know it compiles
@@ -465,6 +475,11 @@ ReplayResults JitInstance::CompileMethod(MethodContext* MethodToCompile, int mcI
     Instrumentor_GetInsCount(&insCountAfter);
 
     param.results.NumExecutedInstructions = static_cast<long long>(insCountAfter - insCountBefore);
+    if (perfCounters != nullptr)
+    {
+        // Hardware counts take precedence over the instrumentor's.
+        param.results.NumExecutedInstructions = param.results.Counters.Instructions;
+    }
     return param.results;
 }
 
@@ -8,6 +8,7 @@
 #include "simpletimer.h"
 #include "methodcontext.h"
 #include "cycletimer.h"
+#include "perfcounters.h"
 
 enum class ReplayResult
 {
@@ -22,6 +23,7 @@ struct ReplayResults
     bool IsMinOpts = false;
     uint32_t NumCodeBytes = 0;
     uint64_t NumExecutedInstructions = 0;
+    PerfCounterValues Counters;
     CompileResult* CompileResults = nullptr;
 };
 
@@ -51,6 +53,7 @@ public:
     bool forceSetAltJitFlag;
 
     CycleTimer       lt;
+    PerfCounters*    perfCounters = nullptr; // If set, hardware counters are collected around each compilation
     MethodContext*   mc;
     ULONGLONG        times[2];
     ICorJitCompiler* pJitInstance;
@@ -9,6 +9,7 @@
 #include "commandline.h"
 #include "errorhandling.h"
 #include "fileio.h"
+#include "perfcounters.h"
 
 // Forward declare the conversion method. Including spmiutil.h pulls in other headers
 // that cause build breaks.
@@ -212,6 +213,7 @@ void ProcessChildStdOut(const CommandLine::Options& o,
                         int*                        excluded,
                         int*                        missing,
                         int*                        diffs,
+                        PerfCounterDiffStats*       perfCounterDiffStats,
                         bool*                       usageError)
 {
     char buff[MAX_LOG_LINE_SIZE];
@@ -268,6 +270,20 @@ void ProcessChildStdOut(const CommandLine::Options& o,
             *excluded += childExcluded;
             *missing += childMissing;
         }
+        else if (strncmp(buff, g_PerfCountersRawFixedPrefix, strlen(g_PerfCountersRawFixedPrefix)) == 0)
+        {
+            PerfCounterDiffStats childStats;
+            if (!childStats.ParseRaw(buff))
+            {
+                LogError("Couldn't parse performance counters message: \"%s\"", buff);
+                continue;
+            }
+            perfCounterDiffStats->Merge(childStats);
+        }
+        else if (strncmp(buff, g_PerfCountersSummaryFixedPrefix, strlen(g_PerfCountersSummaryFixedPrefix)) == 0)
+        {
+            // The per-worker summary is superseded by the one computed from the merged counters.
+        }
         else
         {
             // Do output pass-through.
@@ -458,6 +474,7 @@ char* ConstructChildProcessArgs(const CommandLine::Options& o)
     ADDARG_BOOL(o.breakOnException, "-box");
     ADDARG_BOOL(o.ignoreStoredConfig, "-ignoreStoredConfig");
     ADDARG_BOOL(o.applyDiff, "-applyDiff");
+    ADDARG_BOOL(o.perfCounters, "-perfCounters");
     ADDARG_STRING(o.verbosity, "-verbosity");
     ADDARG_STRING(o.reproName, "-reproName");
     ADDARG_STRING(o.methodStatsTypes, "-emitMethodStats");
@@ -674,6 +691,7 @@ int doParallelSuperPMI(CommandLine::Options& o)
         bool usageError = false; // variable to flag if we hit a usage error in SuperPMI
 
         int loaded = 0, jitted = 0, failed = 0, excluded = 0, missing = 0, diffs = 0;
+        PerfCounterDiffStats perfCounterDiffStats;
 
         // Read the stderr files and log them as errors
         // Read the stdout files and parse them for counts and log any MISSING or ISSUE errors
@@ -681,7 +699,8 @@ int doParallelSuperPMI(CommandLine::Options& o)
         {
             PerWorkerData& wd = perWorkerData[i];
             ProcessChildStdErr(wd.stdErrorPath);
-            ProcessChildStdOut(o, wd.stdOutputPath, &loaded, &jitted, &failed, &excluded, &missing, &diffs, &usageError);
+            ProcessChildStdOut(o, wd.stdOutputPath, &loaded, &jitted, &failed, &excluded, &missing, &diffs,
+                               &perfCounterDiffStats, &usageError);
 
             if (usageError)
                 break;
@@ -709,6 +728,11 @@ int doParallelSuperPMI(CommandLine::Options& o)
             {
                 LogInfo(g_SummaryFormatString, loaded, jitted, failed, excluded, missing);
             }
+
+            if (o.perfCounters && (o.nameOfJit2 != nullptr))
+            {
+                perfCounterDiffStats.LogSummary();
+            }
         }
 
         st.Stop();
@@ -0,0 +1,237 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//-----------------------------------------------------------------------------
+// PerfCounters.cpp - Hardware performance counters for measuring JIT throughput
+//-----------------------------------------------------------------------------
+
+#include "standardpch.h"
+#include "perfcounters.h"
+#include "logging.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // __linux__
+
+// NOTE: these output strings are parsed (or, for the summary, dropped) by
+// parallelsuperpmi.cpp::ProcessChildStdOut().
+const char* const g_PerfCountersRawFixedPrefix     = "PerfCounters ";
+const char* const g_PerfCountersSummaryFixedPrefix = "Throughput ";
+static const char* const g_PerfCountersRawPrintFormat =
+    "PerfCounters Instructions %d %llu %llu %.17g %.17g Cycles %d %llu %llu %.17g %.17g CacheMisses %d %llu %llu %.17g %.17g";
+static const char* const g_PerfCountersRawScanFormat =
+    "PerfCounters Instructions %d %llu %llu %lg %lg Cycles %d %llu %llu %lg %lg CacheMisses %d %llu %llu %lg %lg";
+
+PerfCounters::PerfCounters()
+{
+    for (int i = 0; i < NumCounters; i++)
+    {
+        fds[i] = -1;
+    }
+}
+
+PerfCounters::~PerfCounters()
+{
+#if defined(__linux__)
+    for (int i = 0; i < NumCounters; i++)
+    {
+        if (fds[i] != -1)
+        {
+            close(fds[i]);
+        }
+    }
+#endif // __linux__
+}
+
+#if defined(__linux__)
+static int OpenPerfCounter(uint64_t config, int groupFd)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size           = sizeof(attr);
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.config         = config;
+    attr.disabled       = (groupFd == -1) ? 1 : 0; // The group is enabled/disabled through its leader
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+    attr.read_format    = PERF_FORMAT_GROUP;
+
+    // Count the calling thread on any CPU.
+    return (int)syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0);
+}
+#endif // __linux__
+
+bool PerfCounters::Initialize()
+{
+#if defined(__linux__)
+    // The instructions counter is the group leader; the others are scheduled together with it.
+    static const uint64_t configs[NumCounters] = {PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CPU_CYCLES,
+                                                  PERF_COUNT_HW_CACHE_MISSES};
+
+    for (int i = 0; i < NumCounters; i++)
+    {
+        fds[i] = OpenPerfCounter(configs[i], fds[0]);
+        if (fds[i] == -1)
+        {
+            LogError("perf_event_open failed for counter %d (errno=%d). Check /proc/sys/kernel/perf_event_paranoid.",
+                     i, errno);
+            return false;
+        }
+    }
+
+    return true;
+#else  // !__linux__
+    LogError("-perfCounters is only supported on Linux.");
+    return false;
+#endif // !__linux__
+}
+
+void PerfCounters::Start()
+{
+#if defined(__linux__)
+    ioctl(fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif // __linux__
+}
+
+PerfCounterValues PerfCounters::Stop()
+{
+    PerfCounterValues values;
+
+#if defined(__linux__)
+    ioctl(fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    struct
+    {
+        uint64_t nr;
+        uint64_t values[NumCounters];
+    } groupData;
+
+    if ((read(fds[0], &groupData, sizeof(groupData)) != (ssize_t)sizeof(groupData)) || (groupData.nr != NumCounters))
+    {
+        LogWarning("Failed to read performance counters.");
+        return values;
+    }
+
+    values.Instructions = groupData.values[0];
+    values.Cycles       = groupData.values[1];
+    values.CacheMisses  = groupData.values[2];
+#endif // __linux__
+
+    return values;
+}
+
+bool PerfCounters::PinCurrentThread(int processor)
+{
+#ifdef TARGET_UNIX
+    return PAL_SetCurrentThreadAffinity((WORD)processor) != FALSE;
+#else  // !TARGET_UNIX
+    if (processor >= (int)(sizeof(DWORD_PTR) * 8))
+    {
+        return false;
+    }
+    return SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << processor) != 0;
+#endif // !TARGET_UNIX
+}
+
+void PerfCounterDiffStats::Metric::Record(uint64_t base, uint64_t diff)
+{
+    BaseTotal += base;
+    DiffTotal += diff;
+
+    // Methods that registered no events don't contribute to the per-method relative difference.
+    if (base != 0)
+    {
+        double relDelta = ((double)diff - (double)base) / (double)base;
+        Count++;
+        SumRelDelta += relDelta;
+        SumRelDeltaSq += relDelta * relDelta;
+    }
+}
+
+void PerfCounterDiffStats::Metric::Merge(const Metric& other)
+{
+    Count += other.Count;
+    BaseTotal += other.BaseTotal;
+    DiffTotal += other.DiffTotal;
+    SumRelDelta += other.SumRelDelta;
+    SumRelDeltaSq += other.SumRelDeltaSq;
+}
+
+void PerfCounterDiffStats::Metric::LogSummary(const char* name) const
+{
+    double totalDelta = (BaseTotal == 0) ? 0 : 100.0 * ((double)DiffTotal - (double)BaseTotal) / (double)BaseTotal;
+    if (Count < 2)
+    {
+        LogInfo("Throughput %s: base %llu, diff %llu (%+.3f%%)", name, (unsigned long long)BaseTotal,
+                (unsigned long long)DiffTotal, totalDelta);
+        return;
+    }
+
+    // Mean of the per-method relative differences, with a normal approximation of its 95% confidence interval.
+    double mean     = SumRelDelta / Count;
+    double variance = (SumRelDeltaSq - SumRelDelta * mean) / (Count - 1);
+    double halfCI   = 1.96 * sqrt(variance > 0 ? variance : 0) / sqrt((double)Count);
+
+    LogInfo("Throughput %s: base %llu, diff %llu (%+.3f%%), per-method mean %+.3f%% +/- %.3f%% (95%% CI, %d methods)", name,
+            (unsigned long long)BaseTotal, (unsigned long long)DiffTotal, totalDelta, 100.0 * mean, 100.0 * halfCI,
+            Count);
+}
+
+void PerfCounterDiffStats::Record(const PerfCounterValues& base, const PerfCounterValues& diff)
+{
+    instructions.Record(base.Instructions, diff.Instructions);
+    cycles.Record(base.Cycles, diff.Cycles);
+    cacheMisses.Record(base.CacheMisses, diff.CacheMisses);
+}
+
+void PerfCounterDiffStats::Merge(const PerfCounterDiffStats& other)
+{
+    instructions.Merge(other.instructions);
+    cycles.Merge(other.cycles);
+    cacheMisses.Merge(other.cacheMisses);
+}
+
+void PerfCounterDiffStats::LogRaw() const
+{
+    LogInfo(g_PerfCountersRawPrintFormat,
+            instructions.Count, (unsigned long long)instructions.BaseTotal, (unsigned long long)instructions.DiffTotal,
+            instructions.SumRelDelta, instructions.SumRelDeltaSq,
+            cycles.Count, (unsigned long long)cycles.BaseTotal, (unsigned long long)cycles.DiffTotal,
+            cycles.SumRelDelta, cycles.SumRelDeltaSq,
+            cacheMisses.Count, (unsigned long long)cacheMisses.BaseTotal, (unsigned long long)cacheMisses.DiffTotal,
+            cacheMisses.SumRelDelta, cacheMisses.SumRelDeltaSq);
+}
+
+bool PerfCounterDiffStats::ParseRaw(const char* line)
+{
+    Metric* metrics[] = {&instructions, &cycles, &cacheMisses};
+    unsigned long long totals[6];
+
+    int converted = sscanf_s(line, g_PerfCountersRawScanFormat,
+                             &metrics[0]->Count, &totals[0], &totals[1], &metrics[0]->SumRelDelta, &metrics[0]->SumRelDeltaSq,
+                             &metrics[1]->Count, &totals[2], &totals[3], &metrics[1]->SumRelDelta, &metrics[1]->SumRelDeltaSq,
+                             &metrics[2]->Count, &totals[4], &totals[5], &metrics[2]->SumRelDelta, &metrics[2]->SumRelDeltaSq);
+    if (converted != 15)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < 3; i++)
+    {
+        metrics[i]->BaseTotal = totals[2 * i];
+        metrics[i]->DiffTotal = totals[2 * i + 1];
+    }
+
+    return true;
+}
+
+void PerfCounterDiffStats::LogSummary() const
+{
+    instructions.LogSummary("Instructions");
+    cycles.LogSummary("Cycles");
+    cacheMisses.LogSummary("Cache misses");
+}
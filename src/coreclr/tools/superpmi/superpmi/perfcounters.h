@@ -0,0 +1,74 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//-----------------------------------------------------------------------------
+// PerfCounters.h - Hardware performance counters for measuring JIT throughput
+//-----------------------------------------------------------------------------
+#ifndef _PerfCounters
+#define _PerfCounters
+
+struct PerfCounterValues
+{
+    uint64_t Instructions = 0;
+    uint64_t Cycles       = 0;
+    uint64_t CacheMisses  = 0;
+};
+
+// Counts user-mode instructions retired, cycles and cache misses of the current
+// thread between Start() and Stop(). Only supported on Linux (perf_event_open).
+class PerfCounters
+{
+public:
+    PerfCounters();
+    ~PerfCounters();
+
+    bool Initialize();
+
+    void              Start();
+    PerfCounterValues Stop();
+
+    // Pin the current thread to the given processor, so that the counts of parallel
+    // workers are not disturbed by migrations.
+    static bool PinCurrentThread(int processor);
+
+private:
+    static const int NumCounters = 3;
+    int              fds[NumCounters];
+};
+
+// Accumulates per-method base/diff counter values of a two JIT replay and reports
+// the relative difference with a 95% confidence interval. The raw sums can be
+// round-tripped through the child process output in -parallel mode.
+class PerfCounterDiffStats
+{
+public:
+    void Record(const PerfCounterValues& base, const PerfCounterValues& diff);
+    void Merge(const PerfCounterDiffStats& other);
+
+    void LogRaw() const;
+    bool ParseRaw(const char* line);
+    void LogSummary() const;
+
+private:
+    struct Metric
+    {
+        int      Count         = 0;
+        uint64_t BaseTotal     = 0;
+        uint64_t DiffTotal     = 0;
+        double   SumRelDelta   = 0;
+        double   SumRelDeltaSq = 0;
+
+        void Record(uint64_t base, uint64_t diff);
+        void Merge(const Metric& other);
+        void LogSummary(const char* name) const;
+    };
+
+    Metric instructions;
+    Metric cycles;
+    Metric cacheMisses;
+};
+
+extern const char* const g_PerfCountersRawFixedPrefix;
+extern const char* const g_PerfCountersSummaryFixedPrefix;
+
+#endif
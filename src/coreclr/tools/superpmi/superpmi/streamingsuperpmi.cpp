@@ -14,6 +14,7 @@
 #include "spmiutil.h"
 #include "fileio.h"
 #include "commandline.h"
+#include "perfcounters.h"
 
 #if defined(_WIN32)
 #define strtok_r strtok_s
@@ -171,6 +172,16 @@ int doStreamingSuperPMI(CommandLine::Options& o)
 
     JitInstance* jit = nullptr;
 
+    PerfCounters* perfCounters = nullptr;
+    if (o.perfCounters)
+    {
+        perfCounters = new PerfCounters();
+        if (!perfCounters->Initialize())
+        {
+            return (int)SpmiResult::GeneralFailure;
+        }
+    }
+
     enum { BUFFER_SIZE = 2048 };
 
     char line[BUFFER_SIZE];
@@ -274,6 +285,7 @@ int doStreamingSuperPMI(CommandLine::Options& o)
                 // InitJit already printed a failure message
                 return (int)SpmiResult::JitFailedToInit;
             }
+            jit->perfCounters = perfCounters;
         }
         else
         {
@@ -303,9 +315,12 @@ int doStreamingSuperPMI(CommandLine::Options& o)
                 (o.nameOfJit2 == nullptr) ? "" : " by JIT1", o.nameOfJit);
         }
 
-        // Protocol with clients is for them to read stdout. Let them know we're done.
+        // Protocol with clients is for them to read stdout. Let them know we're done, along with
+        // the code size, compile time and (with -perfCounters) instruction count of this compilation,
+        // so what-if comparisons of JIT options don't need a separate replay to collect them.
         //
-        printf("[streaming] Done. Status=%d\n", (int) res.Result);
+        printf("[streaming] Done. Status=%d Size=%u Milliseconds=%.3f Instructions=%llu\n", (int) res.Result,
+               res.NumCodeBytes, mc->cr->secondsToCompile * 1000.0, (unsigned long long)res.NumExecutedInstructions);
         fflush(stdout);
 
         // Cleanup
@@ -314,5 +329,7 @@ int doStreamingSuperPMI(CommandLine::Options& o)
         mc->Reset();
     }
 
+    delete perfCounters;
+
     return (int)SpmiResult::Success;
 }
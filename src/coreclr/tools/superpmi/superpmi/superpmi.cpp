@@ -19,6 +19,7 @@
 #include "methodstatsemitter.h"
 #include "spmiutil.h"
 #include "fileio.h"
+#include "perfcounters.h"
 
 extern int doParallelSuperPMI(CommandLine::Options& o);
 extern int doStreamingSuperPMI(CommandLine::Options& o);
@@ -140,6 +141,7 @@ static const char* ResultToString(ReplayResult result)
 static void PrintDiffsCsvHeader(FileWriter& fw)
 {
     fw.Print("Context,Context size,Method full name,Tier name,Base result,Diff result,MinOpts,Has diff,Base size,Diff size,Base instructions,Diff instructions");
+    fw.Print(",Base cycles,Diff cycles,Base cache misses,Diff cache misses");
 
 #define JITMETADATAINFO(name, type, flags)
 #define JITMETADATAMETRIC(name, type, flags) fw.Print(",Base " #name ",Diff " #name);
@@ -166,6 +168,10 @@ static void PrintDiffsCsvRow(
         hasDiff ? "True" : "False",
         baseRes.NumCodeBytes, diffRes.NumCodeBytes,
         baseRes.NumExecutedInstructions, diffRes.NumExecutedInstructions);
+    fw.Printf(
+        ",%llu,%llu,%llu,%llu",
+        (unsigned long long)baseRes.Counters.Cycles, (unsigned long long)diffRes.Counters.Cycles,
+        (unsigned long long)baseRes.Counters.CacheMisses, (unsigned long long)diffRes.Counters.CacheMisses);
 
 #define JITMETADATAINFO(name, type, flags)
 #define JITMETADATAMETRIC(name, type, flags) \
@@ -181,7 +187,7 @@ static void PrintDiffsCsvRow(
 
 static void PrintReplayCsvHeader(FileWriter& fw)
 {
-    fw.Printf("Context,Context size,Method full name,Tier name,Result,MinOpts,Size,Instructions");
+    fw.Printf("Context,Context size,Method full name,Tier name,Result,MinOpts,Size,Instructions,Cycles,Cache misses");
 
 #define JITMETADATAINFO(name, type, flags)
 #define JITMETADATAMETRIC(name, type, flags) fw.Print("," #name);
@@ -203,6 +209,7 @@ static void PrintReplayCsvRow(
         ResultToString(res.Result),
         res.IsMinOpts ? "True" : "False",
         res.NumCodeBytes, res.NumExecutedInstructions);
+    fw.Printf(",%llu,%llu", (unsigned long long)res.Counters.Cycles, (unsigned long long)res.Counters.CacheMisses);
 
 #define JITMETADATAINFO(name, type, flags)
 #define JITMETADATAMETRIC(name, type, flags) \
@@ -258,6 +265,8 @@ int __cdecl main(int argc, char* argv[])
     bool   collectThroughput = false;
     MCList failingToReplayMCL;
     FileWriter detailsCsv;
+    PerfCounters* perfCounters = nullptr;
+    PerfCounterDiffStats perfCounterDiffStats;
 
     CommandLine::Options o;
     if (!CommandLine::Parse(argc, argv, &o))
@@ -360,6 +369,27 @@ int __cdecl main(int argc, char* argv[])
         }
     }
 
+    if (o.perfCounters)
+    {
+        // A -parallel worker (started with -stride <index> <count>) gets a processor of its own.
+        if (o.offset > 0)
+        {
+            SYSTEM_INFO sysinfo;
+            GetSystemInfo(&sysinfo);
+            int processor = (o.offset - 1) % (int)sysinfo.dwNumberOfProcessors;
+            if (!PerfCounters::PinCurrentThread(processor))
+            {
+                LogWarning("Failed to pin worker %d to processor %d", o.offset, processor);
+            }
+        }
+
+        perfCounters = new PerfCounters();
+        if (!perfCounters->Initialize())
+        {
+            return (int)SpmiResult::GeneralFailure;
+        }
+    }
+
     if (o.details != nullptr)
     {
         if (o.applyDiff)
@@ -433,6 +463,7 @@ int __cdecl main(int argc, char* argv[])
                     // InitJit already printed a failure message
                     return (int)SpmiResult::JitFailedToInit;
                 }
+                jit->perfCounters = perfCounters;
 
                 if (o.nameOfJit2 != nullptr)
                 {
@@ -443,6 +474,7 @@ int __cdecl main(int argc, char* argv[])
                         // InitJit already printed a failure message
                         return (int)SpmiResult::JitFailedToInit;
                     }
+                    jit2->perfCounters = perfCounters;
                 }
             }
 
@@ -559,6 +591,11 @@ int __cdecl main(int argc, char* argv[])
 
             if ((res.Result == ReplayResult::Success) && (res2.Result == ReplayResult::Success))
             {
+                if ((perfCounters != nullptr) && (o.nameOfJit2 != nullptr))
+                {
+                    perfCounterDiffStats.Record(res.Counters, res2.Counters);
+                }
+
                 if (collectThroughput)
                 {
                     if ((o.nameOfJit2 != nullptr) && (res2.Result == ReplayResult::Success))
@@ -794,6 +831,13 @@ doneRepeatCount:
         LogInfo(g_SummaryFormatString, loadedCount, jittedCount, failToReplayCount, excludedCount, missingCount);
     }
 
+    if ((perfCounters != nullptr) && (o.nameOfJit2 != nullptr))
+    {
+        perfCounterDiffStats.LogRaw();
+        perfCounterDiffStats.LogSummary();
+    }
+    delete perfCounters;
+
     st2.Stop();
     LogVerbose("Total time: %fms", st2.GetMilliseconds());
 
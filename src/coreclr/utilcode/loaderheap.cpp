@@ -2417,4 +2417,19 @@ void AllocMemTracker::SuppressRelease()
     m_fReleased = TRUE;
 }
 
+size_t AllocMemTracker::GetTrackedBytes()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    size_t cbTracked = 0;
+    for (AllocMemTrackerBlock *pBlock = m_pFirstBlock; pBlock != NULL; pBlock = pBlock->m_pNext)
+    {
+        for (int i = 0; i < pBlock->m_nextFree; i++)
+        {
+            cbTracked += pBlock->m_Node[i].m_dwRequestedSize;
+        }
+    }
+    return cbTracked;
+}
+
 #endif //#ifndef DACCESS_COMPILE
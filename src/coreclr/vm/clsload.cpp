@@ -2586,6 +2586,114 @@ ClassLoader::LoadApproxParentThrowing(
     return pParentMethodTable;
 } // ClassLoader::LoadApproxParentThrowing
 
+#if defined(FEATURE_EVENT_TRACE)
+//---------------------------------------------------------------------------------------
+//
+// Measures the cost of one LoadTypeHandleForTypeKey call for the TypeCreationStats event,
+// enabled by DOTNET_TypeCreationStats together with the TypeDiagnostic keyword. The time
+// reported is exclusive: loads nested in this one (parents, interfaces, field types) report
+// their own cost, and their inclusive time is subtracted from the enclosing load's. The
+// loader heap bytes are those kept by the types created at this level.
+//
+class TypeCreationStatsHolder
+{
+    static thread_local TypeCreationStatsHolder * t_pCurrent;
+    static LONG s_configEnabled;
+
+    TypeCreationStatsHolder * m_pPrevious;
+    NormalizedTimer m_timer;
+    int64_t m_nestedTicks;
+    size_t m_cbLoaderHeap;
+    bool m_fActive;
+    bool m_fStopped;
+
+    static bool IsEnabled()
+    {
+        WRAPPER_NO_CONTRACT;
+
+        LONG enabled = VolatileLoadWithoutBarrier(&s_configEnabled);
+        if (enabled == -1)
+        {
+            enabled = (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_TypeCreationStats) != 0) ? 1 : 0;
+            VolatileStoreWithoutBarrier(&s_configEnabled, enabled);
+        }
+
+        return (enabled != 0) && ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TypeCreationStats);
+    }
+
+    void StopTimer()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        if (!m_fStopped)
+        {
+            m_timer.Stop();
+            m_fStopped = true;
+        }
+    }
+
+public:
+    TypeCreationStatsHolder()
+        : m_pPrevious(NULL), m_nestedTicks(0), m_cbLoaderHeap(0), m_fActive(IsEnabled()), m_fStopped(false)
+    {
+        WRAPPER_NO_CONTRACT;
+
+        if (m_fActive)
+        {
+            m_pPrevious = t_pCurrent;
+            t_pCurrent = this;
+            m_timer.Start();
+        }
+    }
+
+    ~TypeCreationStatsHolder()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        if (m_fActive)
+        {
+            StopTimer();
+
+            _ASSERTE(t_pCurrent == this);
+            t_pCurrent = m_pPrevious;
+            if (m_pPrevious != NULL)
+            {
+                m_pPrevious->m_nestedTicks += m_timer.Elapsed100nsTicks();
+            }
+        }
+    }
+
+    // Called when a type created by the current load has been published.
+    static void NoteTypeCreated(AllocMemTracker * pamTracker)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        TypeCreationStatsHolder * pCurrent = t_pCurrent;
+        if (pCurrent != NULL)
+        {
+            pCurrent->m_cbLoaderHeap += pamTracker->GetTrackedBytes();
+        }
+    }
+
+    void Report(UINT32 typeLoad, TypeHandle typeHnd)
+    {
+        WRAPPER_NO_CONTRACT;
+
+        if (!m_fActive)
+            return;
+
+        StopTimer();
+
+        int64_t exclusiveTicks = m_timer.Elapsed100nsTicks() - m_nestedTicks;
+        FireEtwTypeCreationStats(typeLoad, GetClrInstanceId(), (UINT64)typeHnd.AsPtr(),
+                                 (UINT64)max(exclusiveTicks, (int64_t)0), (UINT64)m_cbLoaderHeap);
+    }
+};
+
+thread_local TypeCreationStatsHolder * TypeCreationStatsHolder::t_pCurrent = NULL;
+LONG TypeCreationStatsHolder::s_configEnabled = -1;
+#endif // FEATURE_EVENT_TRACE
+
 // Perform a single phase of class loading
 // It is the caller's responsibility to lock
 /*static*/
@@ -2622,7 +2730,12 @@ TypeHandle ClassLoader::DoIncrementalLoad(const TypeKey *pTypeKey, TypeHandle ty
                 CONSISTENCY_CHECK(!typeHnd.IsNull());
                 TypeHandle published = PublishType(pTypeKey, typeHnd);
                 if (published == typeHnd)
+                {
+#if defined(FEATURE_EVENT_TRACE)
+                    TypeCreationStatsHolder::NoteTypeCreated(&amTracker);
+#endif
                     amTracker.SuppressRelease();
+                }
                 typeHnd = published;
             }
             break;
@@ -3000,6 +3113,7 @@ TypeHandle ClassLoader::LoadTypeHandleForTypeKey(const TypeKey *pTypeKey,
 
 #if defined(FEATURE_EVENT_TRACE)
     UINT32 typeLoad = ETW::TypeSystemLog::TypeLoadBegin();
+    TypeCreationStatsHolder typeCreationStats;
 #endif
 
     ClassLoadLevel currentLevel = typeHnd.IsNull() ? CLASS_LOAD_BEGIN : typeHnd.GetLoadLevel();
@@ -3020,6 +3134,7 @@ TypeHandle ClassLoader::LoadTypeHandleForTypeKey(const TypeKey *pTypeKey,
     {
         ETW::TypeSystemLog::TypeLoadEnd(typeLoad, typeHnd, (UINT16)targetLevel);
     }
+    typeCreationStats.Report(typeLoad, typeHnd);
 #endif
 
     return typeHnd;
@@ -2423,6 +2423,7 @@ HeapList* LoaderCodeHeap::CreateCodeHeap(CodeHeapRequestInfo *pInfo, LoaderHeap
 
     size_t heapSize = pCodeHeap->m_LoaderHeap.GetReservedBytesFree();
     size_t nibbleMapSize = HEAP2MAPSIZE(ROUND_UP_TO_PAGE(heapSize));
+    size_t skipMapSize = HEAP2SKIPMAPSIZE(ROUND_UP_TO_PAGE(heapSize));
 
     pHp->startAddress = (TADDR)pCodeHeap->m_LoaderHeap.GetAllocPtr();
 
@@ -2437,6 +2438,7 @@ HeapList* LoaderCodeHeap::CreateCodeHeap(CodeHeapRequestInfo *pInfo, LoaderHeap
 
     pHp->mapBase         = ROUND_DOWN_TO_PAGE(pHp->startAddress);  // round down to next lower page align
     pHp->pHdrMap         = (DWORD*)(void*)pJitMetaHeap->AllocMem(S_SIZE_T(nibbleMapSize));
+    pHp->pSkipMap        = (DWORD*)(void*)pJitMetaHeap->AllocMem(S_SIZE_T(skipMapSize));
 
     pHp->pLoaderAllocator = pInfo->m_pAllocator;
 
@@ -3171,7 +3173,7 @@ JumpStubBlockHeader *  EEJitManager::allocJumpStubBlock(MethodDesc* pMD, DWORD n
         ExecutableWriterHolder<CodeHeader> codeHdrWriterHolder(pCodeHdr, sizeof(CodeHeader));
         codeHdrWriterHolder.GetRW()->SetStubCodeBlockKind(STUB_CODE_BLOCK_JUMPSTUB);
 
-        NibbleMapSetUnlocked(pCodeHeap, mem, TRUE);
+        NibbleMapSetUnlocked(pCodeHeap, mem, blockSize);
 
         blockWriterHolder.AssignExecutableWriterHolder((JumpStubBlockHeader *)mem, sizeof(JumpStubBlockHeader));
 
@@ -3223,7 +3225,7 @@ void * EEJitManager::allocCodeFragmentBlock(size_t blockSize, unsigned alignment
         ExecutableWriterHolder<CodeHeader> codeHdrWriterHolder(pCodeHdr, sizeof(CodeHeader));
         codeHdrWriterHolder.GetRW()->SetStubCodeBlockKind(kind);
 
-        NibbleMapSetUnlocked(pCodeHeap, mem, TRUE);
+        NibbleMapSetUnlocked(pCodeHeap, mem, blockSize);
 
         // Record the jump stub reservation
         pCodeHeap->reserveForJumpStubs += requestInfo.getReserveForJumpStubs();
@@ -3370,7 +3372,7 @@ void EEJitManager::RemoveJitData (CodeHeader * pCHdr, size_t GCinfo_len, size_t
         if (pHp == NULL)
             return;
 
-        NibbleMapSetUnlocked(pHp, (TADDR)(pCHdr + 1), FALSE);
+        NibbleMapDeleteUnlocked(pHp, (TADDR)(pCHdr + 1));
     }
 
     // Backout the GCInfo
@@ -3532,7 +3534,7 @@ void EEJitManager::FreeCodeMemory(HostCodeHeap *pCodeHeap, void * codeStart)
     // so pCodeHeap can only be a HostCodeHeap.
 
     // clean up the NibbleMap
-    NibbleMapSetUnlocked(pCodeHeap->m_pHeapList, (TADDR)codeStart, FALSE);
+    NibbleMapDeleteUnlocked(pCodeHeap->m_pHeapList, (TADDR)codeStart);
 
     // The caller of this method doesn't call HostCodeHeap->FreeMemForCode
     // directly because the operation should be protected by m_CodeHeapCritSec.
@@ -4010,13 +4012,35 @@ TADDR EEJitManager::FindMethodCode(RangeSection * pRangeSection, PCODE currentPC
 
     startPos = ((startPos >> LOG2_NIBBLES_PER_DWORD) << LOG2_NIBBLES_PER_DWORD) - 1;
 
+    // If a method that started in an earlier block spans into the block containing
+    // currentPC, the skip map records its start and the backwards scan only has to
+    // cover the current block.
+
+    PTR_DWORD pMapScanLimit = pMapStart;
+    DWORD skipEntry = 0;
+
+    if (pHp->pSkipMap != NULL)
+    {
+        size_t skipPos = ADDR2SKIPPOS(delta);
+        skipEntry = VolatileLoadWithoutBarrier<DWORD>(pHp->pSkipMap + skipPos);
+        if (skipEntry != 0)
+        {
+            pMapScanLimit = pMapStart + (skipPos << LOG2_DWORDS_PER_SKIP_ENTRY);
+        }
+    }
+
     // Skip "headerless" DWORDS
 
-    while (pMapStart < pMap && 0 == (tmp = VolatileLoadWithoutBarrier<DWORD>(--pMap)))
+    while (pMapScanLimit < pMap && 0 == (tmp = VolatileLoadWithoutBarrier<DWORD>(--pMap)))
     {
         startPos -= NIBBLES_PER_DWORD;
     }
 
+    if (tmp == 0 && skipEntry != 0)
+    {
+        return base + SKIPENTRY2ADDR(skipEntry);
+    }
+
     // This helps to catch degenerate error cases. This relies on the fact that
     // startPos cannot ever be bigger than MAX_UINT
     if (((INT_PTR)startPos) < 0)
@@ -4038,7 +4062,7 @@ TADDR EEJitManager::FindMethodCode(RangeSection * pRangeSection, PCODE currentPC
 
 #if !defined(DACCESS_COMPILE)
 
-void EEJitManager::NibbleMapSet(HeapList * pHp, TADDR pCode, BOOL bSet)
+void EEJitManager::NibbleMapSet(HeapList * pHp, TADDR pCode, size_t codeSize)
 {
     CONTRACTL {
         NOTHROW;
@@ -4046,10 +4070,10 @@ void EEJitManager::NibbleMapSet(HeapList * pHp, TADDR pCode, BOOL bSet)
     } CONTRACTL_END;
 
     CrstHolder ch(&m_CodeHeapCritSec);
-    NibbleMapSetUnlocked(pHp, pCode, bSet);
+    NibbleMapSetUnlocked(pHp, pCode, codeSize);
 }
 
-void EEJitManager::NibbleMapSetUnlocked(HeapList * pHp, TADDR pCode, BOOL bSet)
+void EEJitManager::NibbleMapSetUnlocked(HeapList * pHp, TADDR pCode, size_t codeSize)
 {
     CONTRACTL {
         NOTHROW;
@@ -4065,7 +4089,7 @@ void EEJitManager::NibbleMapSetUnlocked(HeapList * pHp, TADDR pCode, BOOL bSet)
     size_t delta = pCode - pHp->mapBase;
 
     size_t pos  = ADDR2POS(delta);
-    DWORD value = bSet?ADDR2OFFS(delta):0;
+    DWORD value = ADDR2OFFS(delta);
 
     DWORD index = (DWORD) (pos >> LOG2_NIBBLES_PER_DWORD);
     DWORD mask  = ~((DWORD) HIGHEST_NIBBLE_MASK >> ((pos & NIBBLES_PER_DWORD_MASK) << LOG2_NIBBLE_SIZE));
@@ -4075,11 +4099,66 @@ void EEJitManager::NibbleMapSetUnlocked(HeapList * pHp, TADDR pCode, BOOL bSet)
     PTR_DWORD pMap = pHp->pHdrMap;
 
     // assert that we don't overwrite an existing offset
-    // (it's a reset or it is empty)
-    _ASSERTE(!value || !((*(pMap+index))& ~mask));
+    _ASSERTE(!((*(pMap+index))& ~mask));
 
     // It is important for this update to be atomic. Synchronization would be required with FindMethodCode otherwise.
     *(pMap+index) = ((*(pMap+index))&mask)|value;
+
+    // Record the method start for every block that the method spans into. The nibble is
+    // published first so that FindMethodCode never sees a skip entry without its header.
+    if (pHp->pSkipMap != NULL && codeSize > 0 && delta <= MAX_SKIPENTRY_ADDR)
+    {
+        size_t firstSkipPos = ADDR2SKIPPOS(delta) + 1;
+        size_t lastSkipPos  = ADDR2SKIPPOS(delta + codeSize - 1);
+        DWORD  skipEntry    = ADDR2SKIPENTRY(delta);
+
+        for (size_t skipPos = firstSkipPos; skipPos <= lastSkipPos; skipPos++)
+        {
+            _ASSERTE(pHp->pSkipMap[skipPos] == 0);
+            VolatileStoreWithoutBarrier<DWORD>(pHp->pSkipMap + skipPos, skipEntry);
+        }
+    }
+}
+
+void EEJitManager::NibbleMapDeleteUnlocked(HeapList * pHp, TADDR pCode)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    // Currently all callers to this method ensure EEJitManager::m_CodeHeapCritSec
+    // is held.
+    _ASSERTE(m_CodeHeapCritSec.OwnedByCurrentThread());
+
+    _ASSERTE(pCode >= pHp->mapBase);
+
+    size_t delta = pCode - pHp->mapBase;
+
+    // Clear the skip map entries first, they are the contiguous run of blocks following
+    // the one containing the method start.
+    if (pHp->pSkipMap != NULL && delta <= MAX_SKIPENTRY_ADDR)
+    {
+        size_t skipMapCount = HEAP2SKIPMAPSIZE(ROUND_UP_TO_PAGE(pHp->maxCodeHeapSize)) / sizeof(DWORD);
+        DWORD  skipEntry    = ADDR2SKIPENTRY(delta);
+
+        for (size_t skipPos = ADDR2SKIPPOS(delta) + 1;
+             skipPos < skipMapCount && pHp->pSkipMap[skipPos] == skipEntry;
+             skipPos++)
+        {
+            VolatileStoreWithoutBarrier<DWORD>(pHp->pSkipMap + skipPos, 0);
+        }
+    }
+
+    size_t pos  = ADDR2POS(delta);
+
+    DWORD index = (DWORD) (pos >> LOG2_NIBBLES_PER_DWORD);
+    DWORD mask  = ~((DWORD) HIGHEST_NIBBLE_MASK >> ((pos & NIBBLES_PER_DWORD_MASK) << LOG2_NIBBLE_SIZE));
+
+    PTR_DWORD pMap = pHp->pHdrMap;
+
+    // It is important for this update to be atomic. Synchronization would be required with FindMethodCode otherwise.
+    *(pMap+index) = (*(pMap+index))&mask;
 }
 #endif // !DACCESS_COMPILE
 
@@ -4333,6 +4412,13 @@ void EEJitManager::EnumMemoryRegions(CLRDataEnumMemoryFlags flags)
                 HEAP2MAPSIZE(ROUND_UP_TO_PAGE(heap->maxCodeHeapSize));
             DacEnumMemoryRegion(dac_cast<TADDR>(heap->pHdrMap), nibbleMapSize);
         }
+
+        if (heap->pSkipMap.IsValid())
+        {
+            ULONG32 skipMapSize = (ULONG32)
+                HEAP2SKIPMAPSIZE(ROUND_UP_TO_PAGE(heap->maxCodeHeapSize));
+            DacEnumMemoryRegion(dac_cast<TADDR>(heap->pSkipMap), skipMapSize);
+        }
     }
 }
 #endif // #ifdef DACCESS_COMPILE
@@ -379,6 +379,7 @@ struct HeapList
 
     TADDR               mapBase;        // "startAddress" rounded down to GetOsPageSize(). pHdrMap is relative to this address
     PTR_DWORD           pHdrMap;        // bit array used to find the start of methods
+    PTR_DWORD           pSkipMap;       // per 4k block, start of the method spanning into the block (see nibblemapmacros.h)
 
     size_t              maxCodeHeapSize;// Size of the entire contiguous block of memory
     size_t              reserveForJumpStubs; // Amount of memory reserved for jump stubs in this block
@@ -1820,8 +1821,9 @@ public:
 
 #ifndef DACCESS_COMPILE
 	// Heap Management functions
-    void NibbleMapSet(HeapList * pHp, TADDR pCode, BOOL bSet);
-    void NibbleMapSetUnlocked(HeapList * pHp, TADDR pCode, BOOL bSet);
+    void NibbleMapSet(HeapList * pHp, TADDR pCode, size_t codeSize);
+    void NibbleMapSetUnlocked(HeapList * pHp, TADDR pCode, size_t codeSize);
+    void NibbleMapDeleteUnlocked(HeapList * pHp, TADDR pCode);
 #endif  // !DACCESS_COMPILE
 
     static TADDR FindMethodCode(RangeSection * pRangeSection, PCODE currentPC);
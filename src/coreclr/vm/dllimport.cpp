@@ -935,7 +935,7 @@ public:
     // Truncates a SString by first converting it to unicode and truncate it
     // if it is larger than size. "..." will be appended if it is truncated.
     //
-    void TruncateUnicodeString(SString &string, COUNT_T bufSize)
+    static void TruncateUnicodeString(SString &string, COUNT_T bufSize)
     {
         string.Normalize();
         if ((string.GetCount() + 1) * sizeof(WCHAR) > bufSize)
@@ -4751,6 +4751,37 @@ HRESULT FindPredefinedILStubMethod(MethodDesc *pTargetMD, DWORD dwStubFlags, Met
 
 namespace
 {
+    //---------------------------------------------------------------------------------------
+    //
+    // Reports a target method that attached to an IL stub generated earlier for another
+    // target with the same signature and marshalling flags. Together with ILStubGenerated
+    // this lists every method that depends on a runtime-generated interop stub.
+    //
+    void
+    EtwOnILStubCacheHit(
+        MethodDesc *    pTargetMD,
+        MethodDesc *    pStubMD)
+    {
+        STANDARD_VM_CONTRACT;
+
+        SString strNamespaceOrClassName, strMethodName, strMethodSignature;
+        pTargetMD->GetMethodInfoWithNewSig(strNamespaceOrClassName, strMethodName, strMethodSignature);
+
+        ILStubState::TruncateUnicodeString(strNamespaceOrClassName, ETW_IL_STUB_EVENT_STRING_FIELD_MAXSIZE);
+        ILStubState::TruncateUnicodeString(strMethodName,           ETW_IL_STUB_EVENT_STRING_FIELD_MAXSIZE);
+        ILStubState::TruncateUnicodeString(strMethodSignature,      ETW_IL_STUB_EVENT_STRING_FIELD_MAXSIZE);
+
+        FireEtwILStubCacheHit(
+            GetClrInstanceId(),                         // ClrInstanceId
+            (UINT64)(TADDR)pTargetMD->GetModule(),      // ModuleIdentifier
+            (UINT64)pStubMD,                            // StubMethodIdentifier
+            pTargetMD->GetMemberDef(),                  // ManagedInteropMethodToken
+            strNamespaceOrClassName.GetUnicode(),       // ManagedInteropMethodNamespace
+            strMethodName.GetUnicode(),                 // ManagedInteropMethodName
+            strMethodSignature.GetUnicode()             // ManagedInteropMethodSignature
+            );
+    } // EtwOnILStubCacheHit
+
     //=======================================================================
     // ILStubCreatorHelper
     // The class is used as a helper class in CreateInteropILStub. It mainly
@@ -5141,6 +5172,10 @@ namespace
                     *pGeneratedNewStub = true;
                 }
             }
+            else if (pTargetMD != NULL && ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, ILStubCacheHit))
+            {
+                EtwOnILStubCacheHit(pTargetMD, pStubMD);
+            }
 
             ilStubCreatorHelper.SuppressRelease();
         }
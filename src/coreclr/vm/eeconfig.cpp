@@ -233,6 +233,7 @@ HRESULT EEConfig::Init()
 #if defined(FEATURE_ON_STACK_REPLACEMENT)
     dwOSR_HitLimit = 10;
     dwOSR_CounterBump = 5000;
+    dwOSR_AwaitCounterBump = 0;
 #endif
 
     backpatchEntryPointSlots = false;
@@ -752,6 +753,7 @@ HRESULT EEConfig::sync()
 #if defined(FEATURE_ON_STACK_REPLACEMENT)
     dwOSR_HitLimit = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_HitLimit);
     dwOSR_CounterBump = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_CounterBump);
+    dwOSR_AwaitCounterBump = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_AwaitCounterBump);
 #endif
 
 #if defined(FEATURE_ON_STACK_REPLACEMENT) && defined(_DEBUG)
@@ -105,6 +105,7 @@ public:
     // OSR Config
     DWORD         OSR_CounterBump() const { LIMITED_METHOD_CONTRACT; return dwOSR_CounterBump; }
     DWORD         OSR_HitLimit() const { LIMITED_METHOD_CONTRACT; return dwOSR_HitLimit; }
+    DWORD         OSR_AwaitCounterBump() const { LIMITED_METHOD_CONTRACT; return dwOSR_AwaitCounterBump; }
 #endif
 
 #if defined(FEATURE_ON_STACK_REPLACEMENT) && defined(_DEBUG)
@@ -631,6 +632,7 @@ private: //----------------------------------------------------------------
 #if defined(FEATURE_ON_STACK_REPLACEMENT)
     DWORD dwOSR_HitLimit;
     DWORD dwOSR_CounterBump;
+    DWORD dwOSR_AwaitCounterBump;
 #endif
 
 #if defined(FEATURE_ON_STACK_REPLACEMENT) && defined(_DEBUG)
@@ -52,6 +52,13 @@ bool IsUserEventsEnabled()
 
 bool IsUserEventsEnabledByKeyword(UCHAR providerId, uint8_t level, uint64_t keyword)
 {
+    // Event sites query this before building any payload; skip the per-provider
+    // lookup entirely when user_events was not enabled at startup.
+    if (!s_userEventsEnabled)
+    {
+        return false;
+    }
+
     switch (providerId)
     {
         case 0:
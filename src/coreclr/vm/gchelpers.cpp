@@ -354,6 +354,47 @@ inline SIZE_T MaxArrayLength()
     return 0X7FFFFFC7;
 }
 
+// Carves up to count objects of the given size out of the current thread's allocation context
+// without calling into the GC, like the JIT's portable allocation helpers do for a single object.
+// The allocation context memory is already zeroed. Returns the number of objects carved, which
+// is 0 if they must be allocated (and reported) one at a time.
+static DWORD TryBulkAllocFromThreadContext(size_t size, DWORD count, BYTE** ppStart)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    } CONTRACTL_END;
+
+    if (!GCHeapUtilities::UseThreadAllocationContexts() || TrackAllocations())
+        return 0;
+
+    // GC stress on allocation must see every allocation
+    if (GCStress<cfg_alloc>::IsEnabled())
+        return 0;
+
+#ifdef _LOGALLOC
+    return 0;
+#endif // _LOGALLOC
+
+#ifdef FEATURE_EVENT_TRACE
+    if (ETW::TypeSystemLog::IsHeapAllocEventEnabled())
+        return 0;
+#endif // FEATURE_EVENT_TRACE
+
+    size = ALIGN_UP(size, DATA_ALIGNMENT);
+
+    gc_alloc_context *allocContext = GetThreadAllocContext();
+    BYTE *allocPtr = allocContext->alloc_ptr;
+    _ASSERTE(allocPtr <= allocContext->alloc_limit);
+
+    DWORD carved = (DWORD)min((size_t)count, (size_t)(allocContext->alloc_limit - allocPtr) / size);
+    allocContext->alloc_ptr = allocPtr + (size_t)carved * size;
+
+    *ppStart = allocPtr;
+    return carved;
+}
+
 OBJECTREF AllocateSzArray(TypeHandle arrayType, INT32 cElements, GC_ALLOC_FLAGS flags)
 {
     CONTRACTL{
@@ -498,6 +539,70 @@ OBJECTREF AllocateSzArray(MethodTable* pArrayMT, INT32 cElements, GC_ALLOC_FLAGS
     return ObjectToOBJECTREF((Object*)orArray);
 }
 
+void AllocateSzArrays(MethodTable* pArrayMT, INT32 cElements, PTRARRAYREF* pOuterArray, GC_ALLOC_FLAGS flags)
+{
+    CONTRACTL{
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+        PRECONDITION(CheckPointer(pOuterArray));
+        PRECONDITION((*pOuterArray) != NULL);
+    } CONTRACTL_END;
+
+    _ASSERTE(pArrayMT->GetInternalCorElementType() == ELEMENT_TYPE_SZARRAY);
+
+    // Only arrays that AllocateSzArray would place in the small object heap without any
+    // alignment fix-ups can be carved out of the allocation context. Like the JIT's portable
+    // helpers, limit the length so that the size computation can't overflow.
+    bool canCarve = (flags == GC_ALLOC_NO_FLAGS) && (cElements >= 0) && ((SIZE_T)cElements < 65535 - 256);
+    size_t totalSize = 0;
+    if (canCarve)
+    {
+        totalSize = (size_t)cElements * pArrayMT->GetComponentSize() + pArrayMT->GetBaseSize();
+        canCarve = (totalSize < LARGE_OBJECT_SIZE) && (totalSize < GCHeapUtilities::GetGCHeap()->GetLOHThreshold());
+
+        // Arrays of doubles may need an alignment fix-up or may be sent to the large object heap early.
+        if ((pArrayMT->GetArrayElementType() == ELEMENT_TYPE_R8) && (DATA_ALIGNMENT < sizeof(double)))
+            canCarve = false;
+
+#ifdef FEATURE_64BIT_ALIGNMENT
+        MethodTable *pElementMT = pArrayMT->GetArrayElementTypeHandle().GetMethodTable();
+        if (pElementMT->RequiresAlign8() && pElementMT->IsValueType())
+            canCarve = false;
+#endif
+    }
+
+    const size_t alignedSize = ALIGN_UP(totalSize, DATA_ALIGNMENT);
+    const DWORD count = (*pOuterArray)->GetNumComponents();
+    DWORD i = 0;
+
+    while (i < count)
+    {
+        BYTE* pStart = NULL;
+        DWORD carved = canCarve ? TryBulkAllocFromThreadContext(totalSize, count - i, &pStart) : 0;
+
+        if (carved == 0)
+        {
+            // The allocation context is exhausted (or bulk allocation isn't possible); allocate
+            // one array through the GC, which also hands us a fresh allocation context.
+            OBJECTREF obj = AllocateSzArray(pArrayMT, cElements, flags);
+            (*pOuterArray)->SetAt(i++, obj);
+            continue;
+        }
+
+        // Nothing in this loop can trigger a GC, so the carved memory is never observed
+        // before the MethodTables are set.
+        for (DWORD j = 0; j < carved; j++)
+        {
+            ArrayBase* orArray = (ArrayBase*)(pStart + (size_t)j * alignedSize);
+            _ASSERTE(orArray->HasEmptySyncBlockInfo());
+            orArray->SetMethodTable(pArrayMT);
+            orArray->m_NumComponents = cElements;
+            (*pOuterArray)->SetAt(i++, ObjectToOBJECTREF((Object*)orArray));
+        }
+    }
+}
+
 OBJECTREF TryAllocateFrozenSzArray(MethodTable* pArrayMT, INT32 cElements)
 {
     CONTRACTL{
@@ -784,10 +889,19 @@ OBJECTREF AllocateArrayEx(MethodTable *pArrayMT, INT32 *pArgs, DWORD dwNumArgs,
                 else
                 {
                     TypeHandle subArrayType = pArrayMT->GetArrayElementTypeHandle();
-                    for (UINT32 i = 0; i < cElements; i++)
+                    MethodTable* pSubArrayMT = subArrayType.AsMethodTable();
+                    if ((dwNumArgs == 2) && (pSubArrayMT->GetInternalCorElementType() == ELEMENT_TYPE_SZARRAY))
+                    {
+                        // The innermost dimension: all the arrays have the same type and length
+                        AllocateSzArrays(pSubArrayMT, pArgs[1], &outerArray, flagsOriginal);
+                    }
+                    else
                     {
-                        OBJECTREF obj = AllocateArrayEx(subArrayType, &pArgs[1], dwNumArgs-1, flagsOriginal);
-                        outerArray->SetAt(i, obj);
+                        for (UINT32 i = 0; i < cElements; i++)
+                        {
+                            OBJECTREF obj = AllocateArrayEx(subArrayType, &pArgs[1], dwNumArgs-1, flagsOriginal);
+                            outerArray->SetAt(i, obj);
+                        }
                     }
 
                     iholder.Release();
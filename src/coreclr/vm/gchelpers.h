@@ -23,6 +23,10 @@
 OBJECTREF AllocateSzArray(MethodTable *pArrayMT, INT32 length, GC_ALLOC_FLAGS flags = GC_ALLOC_NO_FLAGS);
 OBJECTREF AllocateSzArray(TypeHandle  arrayType, INT32 length, GC_ALLOC_FLAGS flags = GC_ALLOC_NO_FLAGS);
 
+// Allocate a single-dimensional array of the given type and length for every element of *pOuterArray.
+// Runs of small arrays are carved out of the thread's allocation context at once.
+void AllocateSzArrays(MethodTable *pArrayMT, INT32 length, PTRARRAYREF *pOuterArray, GC_ALLOC_FLAGS flags = GC_ALLOC_NO_FLAGS);
+
 // Allocate single-dimensional array on a frozen segment
 // Returns nullptr if it's not possible.
 OBJECTREF TryAllocateFrozenSzArray(MethodTable* pArrayMT, INT32 length);
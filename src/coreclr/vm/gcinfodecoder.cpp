@@ -889,19 +889,28 @@ bool GcInfoDecoder::EnumerateLiveSlots(
                 m_Reader.Skip(m_SafePointIndex * numSlots);
             }
 
-            for(UINT32 slotIndex = 0; slotIndex < numSlots; slotIndex++)
+            // Scan the live state (almost) a machine word at a time so that runs of dead
+            // slots cost one read instead of one read per slot. Reads are kept one bit short
+            // of a full word since BitStreamReader::Read cannot shift by the full word size.
+            for(UINT32 baseIndex = 0; baseIndex < numSlots; baseIndex += BITS_PER_SIZE_T - 1)
             {
-                if(m_Reader.ReadOneFast())
+                UINT32 numBits = _min(numSlots - baseIndex, (UINT32)(BITS_PER_SIZE_T - 1));
+                size_t liveBits = m_Reader.Read(numBits);
+
+                for(UINT32 slotIndex = baseIndex; liveBits != 0; slotIndex++, liveBits >>= 1)
                 {
-                    ReportSlotToGC(
-                            slotDecoder,
-                            slotIndex,
-                            pRD,
-                            reportScratchSlots,
-                            inputFlags,
-                            pCallBack,
-                            hCallBack
-                            );
+                    if(liveBits & 1)
+                    {
+                        ReportSlotToGC(
+                                slotDecoder,
+                                slotIndex,
+                                pRD,
+                                reportScratchSlots,
+                                inputFlags,
+                                pCallBack,
+                                hCallBack
+                                );
+                    }
                 }
             }
             goto ReportUntracked;
@@ -976,9 +985,10 @@ bool GcInfoDecoder::EnumerateLiveSlots(
             }
             else
             {
-                for(UINT32 i = 0; i < numSlots; i++)
+                for(UINT32 i = 0; i < numSlots; i += BITS_PER_SIZE_T - 1)
                 {
-                    if(m_Reader.ReadOneFast())
+                    size_t couldBeLiveBits = m_Reader.Read(_min(numSlots - i, (UINT32)(BITS_PER_SIZE_T - 1)));
+                    for(; couldBeLiveBits != 0; couldBeLiveBits &= (couldBeLiveBits - 1))
                         numCouldBeLiveSlots++;
                 }
             }
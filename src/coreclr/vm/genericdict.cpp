@@ -532,6 +532,7 @@ Dictionary* Dictionary::GetMethodDictionaryWithSizeCheck(MethodDesc* pMD, ULONG
 
             // Publish the new dictionary slots to the type.
             InterlockedExchangeT(&pIMD->m_pPerInstInfo, pNewDictionary);
+            GenericLookupStats::NoteExpansion(pMD, NULL, pDictLayout->GetMaxSlots());
 
             pDictionary = pNewDictionary;
         }
@@ -592,6 +593,7 @@ Dictionary* Dictionary::GetTypeDictionaryWithSizeCheck(MethodTable* pMT, ULONG s
             ULONG dictionaryIndex = pMT->GetNumDicts() - 1;
             Dictionary** pPerInstInfo = pMT->GetPerInstInfo();
             InterlockedExchangeT(pPerInstInfo + dictionaryIndex, pNewDictionary);
+            GenericLookupStats::NoteExpansion(NULL, pMT, pDictLayout->GetMaxSlots());
 
             pDictionary = pNewDictionary;
         }
@@ -600,6 +602,100 @@ Dictionary* Dictionary::GetTypeDictionaryWithSizeCheck(MethodTable* pMT, ULONG s
     RETURN pDictionary;
 }
 
+GenericLookupStats::Entry GenericLookupStats::s_table[GenericLookupStats::TableSize];
+LONG GenericLookupStats::s_enabled = -1;
+
+bool GenericLookupStats::IsEnabled()
+{
+    WRAPPER_NO_CONTRACT;
+
+    LONG enabled = VolatileLoadWithoutBarrier(&s_enabled);
+    if (enabled == -1)
+    {
+        enabled = (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_GenericLookupStats) != 0) ? 1 : 0;
+        VolatileStoreWithoutBarrier(&s_enabled, enabled);
+    }
+
+    return enabled != 0;
+}
+
+GenericLookupStats::Entry* GenericLookupStats::FindOrAdd(void* owner)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    DWORD start = (DWORD)(((size_t)owner >> 3) % TableSize);
+    for (DWORD i = 0; i < TableSize; i++)
+    {
+        Entry* pEntry = &s_table[(start + i) % TableSize];
+        void* current = VolatileLoad(&pEntry->Owner);
+        if (current == owner)
+            return pEntry;
+
+        if (current == NULL)
+        {
+            current = InterlockedCompareExchangeT(&pEntry->Owner, owner, (void*)NULL);
+            if ((current == NULL) || (current == owner))
+                return pEntry;
+        }
+    }
+
+    return NULL;
+}
+
+void GenericLookupStats::NoteSlowLookup(MethodDesc* pMD, MethodTable* pMT)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (!IsEnabled())
+        return;
+
+    Entry* pEntry = FindOrAdd((pMT != NULL) ? (void*)pMT : (void*)pMD);
+    if (pEntry == NULL)
+        return;
+
+    LONG count = InterlockedIncrement(&pEntry->SlowLookups);
+    if ((count & (count - 1)) == 0)
+    {
+        if (pMT != NULL)
+            STRESS_LOG2(LF_JIT, LL_ALWAYS, "GENERICS: %d slow dictionary lookups for %pT\n", count, pMT);
+        else
+            STRESS_LOG2(LF_JIT, LL_ALWAYS, "GENERICS: %d slow dictionary lookups for %pM\n", count, pMD);
+    }
+}
+
+void GenericLookupStats::NoteExpansion(MethodDesc* pMD, MethodTable* pMT, DWORD numSlots)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (!IsEnabled())
+        return;
+
+    Entry* pEntry = FindOrAdd((pMT != NULL) ? (void*)pMT : (void*)pMD);
+    if (pEntry == NULL)
+        return;
+
+    LONG count = InterlockedIncrement(&pEntry->Expansions);
+    if ((count & (count - 1)) == 0)
+    {
+        if (pMT != NULL)
+            STRESS_LOG3(LF_JIT, LL_ALWAYS, "GENERICS: %d dictionary expansions for %pT, now %d slots\n", count, pMT, numSlots);
+        else
+            STRESS_LOG3(LF_JIT, LL_ALWAYS, "GENERICS: %d dictionary expansions for %pM, now %d slots\n", count, pMD, numSlots);
+    }
+}
+
 struct StaticVirtualDispatchHashBlob : public ILStubHashBlobBase
 {
     MethodDesc *pExactInterfaceMethod;
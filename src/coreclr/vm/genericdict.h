@@ -292,4 +292,37 @@ private:
 #endif // #ifndef DACCESS_COMPILE
 };
 
+#ifndef DACCESS_COMPILE
+
+// Counts slow-path generic dictionary lookups (calls to JIT_GenericHandle) and dictionary
+// expansions per dictionary owner, i.e. the generic method or the generic type whose
+// dictionary missed. Enabled by DOTNET_GenericLookupStats. The counts are reported to the
+// stress log each time they reach a power of two, which makes the owners that keep missing
+// during warmup stand out without the cost of a report at shutdown. The stress log is the
+// only consumer and is off by default, so DOTNET_StressLog=1 is needed to see the counts.
+class GenericLookupStats
+{
+public:
+    static void NoteSlowLookup(MethodDesc* pMD, MethodTable* pMT);
+    static void NoteExpansion(MethodDesc* pMD, MethodTable* pMT, DWORD numSlots);
+
+private:
+    struct Entry
+    {
+        void* Owner;
+        LONG  SlowLookups;
+        LONG  Expansions;
+    };
+
+    // Fixed size, lock free table; owners that don't fit are not counted.
+    static const DWORD TableSize = 1024;
+    static Entry s_table[TableSize];
+    static LONG  s_enabled;
+
+    static bool IsEnabled();
+    static Entry* FindOrAdd(void* owner);
+};
+
+#endif // #ifndef DACCESS_COMPILE
+
 #endif
@@ -2526,6 +2526,8 @@ CORINFO_GENERIC_HANDLE JIT_GenericHandleWorker(MethodDesc * pMD, MethodTable * p
      uint32_t dictionaryIndex = 0;
      MethodTable * pDeclaringMT = NULL;
 
+     GenericLookupStats::NoteSlowLookup(pMD, pMT);
+
     if (pMT != NULL)
     {
         if (pModule != NULL)
@@ -4481,7 +4483,11 @@ void JIT_Patchpoint(int* counter, int ilOffset)
     // the amount of back and forth with the runtime, but this would
     // lock out other patchpoints in the method.
     //
-    // So we always reset the counter to the bump value.
+    // So we always reset the counter to the bump value. The one exception
+    // is the opt-in OSR_AwaitCounterBump below, which only ever lowers the
+    // counter while another thread creates the OSR method. A lower value
+    // can't lock out the other patchpoints, it just brings them back here
+    // sooner.
     //
     // In the prototype, counter is a location in a stack frame,
     // so we can update it without worrying about other threads.
@@ -4570,10 +4576,21 @@ void JIT_Patchpoint(int* counter, int ilOffset)
         }
 
         // Third, make sure no other thread is trying to create the OSR method.
+        //
+        // Threads that find the method in progress share it once it is
+        // published. Optionally (OSR_AwaitCounterBump > 0), reload their
+        // counter with a smaller value so they come back and transition
+        // soon after, rather than running up to another B iterations of
+        // Tier0 code.
+        const int awaitCounterBump = (int)g_pConfig->OSR_AwaitCounterBump();
         LONG oldFlags = ppInfo->m_flags;
         if ((oldFlags & PerPatchpointInfo::patchpoint_triggered) == PerPatchpointInfo::patchpoint_triggered)
         {
             LOG((LF_TIEREDCOMPILATION, LL_INFO1000, "Jit_Patchpoint: AWAITING OSR method for patchpoint [%d] (0x%p)\n", ppId, ip));
+            if (awaitCounterBump > 0)
+            {
+                *counter = min(counterBump, awaitCounterBump);
+            }
             goto DONE;
         }
 
@@ -4583,6 +4600,10 @@ void JIT_Patchpoint(int* counter, int ilOffset)
         if (!triggerTransition)
         {
             LOG((LF_TIEREDCOMPILATION, LL_INFO1000, "Jit_Patchpoint: (lost race) AWAITING OSR method for patchpoint [%d] (0x%p)\n", ppId, ip));
+            if (awaitCounterBump > 0)
+            {
+                *counter = min(counterBump, awaitCounterBump);
+            }
             goto DONE;
         }
 
@@ -93,8 +93,10 @@ deps_json_t::rid_fallback_graph_t deps_json_t::get_rid_fallback_graph(const pal:
     if (!deps_file_exists(deps_path_local))
         return rid_fallback_graph;
 
+    // Only the RID graph is needed; don't build the targets and libraries sections of the DOM.
+    const json_parser_t::member_names_t members { _X("runtimes") };
     json_parser_t json;
-    if (!json.parse_file(deps_path_local))
+    if (!json.parse_file(deps_path_local, &members))
         return rid_fallback_graph;
 
     populate_rid_fallback_graph(json.document(), rid_fallback_graph);
@@ -585,8 +587,10 @@ void deps_json_t::load(bool is_framework_dependent, std::function<void(const jso
         return;
     }
 
+    // Materialize only the sections the resolver reads (e.g. not compilationOptions).
+    const json_parser_t::member_names_t members { _X("runtimeTarget"), _X("targets"), _X("libraries"), _X("runtimes") };
     json_parser_t json;
-    if (!json.parse_file(m_deps_file))
+    if (!json.parse_file(m_deps_file, &members))
         return;
 
     m_valid = true;
@@ -66,6 +66,128 @@ void get_line_column_from_offset(const char* data, uint64_t size, size_t offset,
     }
 }
 
+// Forwards SAX events to the document, dropping the values of root object members that were not asked for.
+// Skipped values are still fully parsed, so malformed JSON is reported the same way as without a filter.
+template <typename Handler>
+class member_filter_t
+{
+public:
+    using Ch = typename Handler::Ch;
+
+    member_filter_t(Handler& handler, const json_parser_t::member_names_t& members)
+        : m_handler(handler)
+        , m_members(members)
+        , m_depth(0)
+        , m_kept_members(0)
+        , m_skipping(false) {}
+
+    bool Null() { return skip() || m_handler.Null(); }
+    bool Bool(bool b) { return skip() || m_handler.Bool(b); }
+    bool Int(int i) { return skip() || m_handler.Int(i); }
+    bool Uint(unsigned i) { return skip() || m_handler.Uint(i); }
+    bool Int64(int64_t i) { return skip() || m_handler.Int64(i); }
+    bool Uint64(uint64_t i) { return skip() || m_handler.Uint64(i); }
+    bool Double(double d) { return skip() || m_handler.Double(d); }
+    bool RawNumber(const Ch* str, rapidjson::SizeType length, bool copy) { return skip() || m_handler.RawNumber(str, length, copy); }
+    bool String(const Ch* str, rapidjson::SizeType length, bool copy) { return skip() || m_handler.String(str, length, copy); }
+
+    bool Key(const Ch* str, rapidjson::SizeType length, bool copy)
+    {
+        if (m_depth == 1)
+        {
+            m_skipping = !is_requested(str, length);
+            if (!m_skipping)
+            {
+                m_kept_members++;
+            }
+        }
+
+        return m_skipping || m_handler.Key(str, length, copy);
+    }
+
+    bool StartObject()
+    {
+        m_depth++;
+        return m_skipping || m_handler.StartObject();
+    }
+
+    bool EndObject(rapidjson::SizeType member_count)
+    {
+        m_depth--;
+        if (skip())
+        {
+            return true;
+        }
+
+        return m_handler.EndObject(m_depth == 0 ? m_kept_members : member_count);
+    }
+
+    bool StartArray()
+    {
+        m_depth++;
+        return m_skipping || m_handler.StartArray();
+    }
+
+    bool EndArray(rapidjson::SizeType element_count)
+    {
+        m_depth--;
+        return skip() || m_handler.EndArray(element_count);
+    }
+
+private:
+    bool is_requested(const Ch* str, rapidjson::SizeType length) const
+    {
+        for (const pal::string_t& member : m_members)
+        {
+            if (member.size() == length && member.compare(0, length, str, length) == 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Swallows the events of a skipped member's value. Once the parser is back at the
+    // level of the root object (after a scalar or the end of a container), the member is done.
+    bool skip()
+    {
+        if (!m_skipping)
+        {
+            return false;
+        }
+
+        if (m_depth == 1)
+        {
+            m_skipping = false;
+        }
+
+        return true;
+    }
+
+    Handler& m_handler;
+    const json_parser_t::member_names_t& m_members;
+    int m_depth;
+    rapidjson::SizeType m_kept_members;
+    bool m_skipping;
+};
+
+template <unsigned flags, typename SourceEncoding, typename Stream>
+rapidjson::ParseResult parse_filtered(json_parser_t::document_t& document, Stream& stream, const json_parser_t::member_names_t& members)
+{
+    rapidjson::ParseResult result;
+    auto generator = [&](json_parser_t::document_t& target)
+    {
+        rapidjson::GenericReader<SourceEncoding, json_parser_t::internal_encoding_type_t> reader;
+        member_filter_t<json_parser_t::document_t> filter(target, members);
+        result = reader.template Parse<flags>(stream, filter);
+        return !result.IsError();
+    };
+
+    document.Populate(generator);
+    return result;
+}
+
 } // empty namespace
 
 void json_parser_t::realloc_buffer(size_t size)
@@ -74,31 +196,48 @@ void json_parser_t::realloc_buffer(size_t size)
     m_json[size] = '\0';
 }
 
-bool json_parser_t::parse_raw_data(char* data, int64_t size, const pal::string_t& context)
+bool json_parser_t::parse_raw_data(char* data, int64_t size, const pal::string_t& context, const member_names_t* top_level_members)
 {
     assert(data != nullptr);
 
     constexpr auto flags = rapidjson::ParseFlag::kParseStopWhenDoneFlag | rapidjson::ParseFlag::kParseCommentsFlag;
+    rapidjson::ParseResult result;
 #ifdef _WIN32
     // Can't use in-situ parsing on Windows, as JSON data is encoded in
     // UTF-8 and the host expects wide strings.  m_document will store
     // data in UTF-16 (with pal::char_t as the character type), but it
     // has to know that data is encoded in UTF-8 to convert during parsing.
-    m_document.Parse<flags, rapidjson::UTF8<>>(data);
+    if (top_level_members != nullptr)
+    {
+        rapidjson::StringStream stream(data);
+        result = parse_filtered<flags, rapidjson::UTF8<>>(m_document, stream, *top_level_members);
+    }
+    else
+    {
+        result = m_document.Parse<flags, rapidjson::UTF8<>>(data);
+    }
 #else // _WIN32
-    m_document.ParseInsitu<flags>(data);
+    if (top_level_members != nullptr)
+    {
+        rapidjson::GenericInsituStringStream<internal_encoding_type_t> stream(data);
+        result = parse_filtered<flags | rapidjson::ParseFlag::kParseInsituFlag, internal_encoding_type_t>(m_document, stream, *top_level_members);
+    }
+    else
+    {
+        result = m_document.ParseInsitu<flags>(data);
+    }
 #endif // _WIN32
 
-    if (m_document.HasParseError())
+    if (result.IsError())
     {
         int line, column;
-        size_t offset = m_document.GetErrorOffset();
+        size_t offset = result.Offset();
 
         get_line_column_from_offset(data, size, offset, &line, &column);
 
         trace::error(_X("A JSON parsing exception occurred in [%s], offset %zu (line %d, column %d): %s"),
             context.c_str(), offset, line, column,
-            rapidjson::GetParseError_En(m_document.GetParseError()));
+            rapidjson::GetParseError_En(result.Code()));
         return false;
     }
 
@@ -111,7 +250,7 @@ bool json_parser_t::parse_raw_data(char* data, int64_t size, const pal::string_t
     return true;
 }
 
-bool json_parser_t::parse_file(const pal::string_t& path)
+bool json_parser_t::parse_file(const pal::string_t& path, const member_names_t* top_level_members)
 {
     // This code assumes that the caller has checked that the file `path` exists
     // either within the bundle, or as a real file on disk.
@@ -127,7 +266,7 @@ bool json_parser_t::parse_file(const pal::string_t& path)
 
         if (m_bundle_data != nullptr)
         {
-            bool result = parse_raw_data(m_bundle_data, m_bundle_location->size, path);
+            bool result = parse_raw_data(m_bundle_data, m_bundle_location->size, path, top_level_members);
             return result;
         }
     }
@@ -153,7 +292,7 @@ bool json_parser_t::parse_file(const pal::string_t& path)
     realloc_buffer(static_cast<size_t>(stream_size - current_pos));
     file.read(m_json.data(), stream_size - current_pos);
 
-    return parse_raw_data(m_json.data(), m_json.size(), path);
+    return parse_raw_data(m_json.data(), m_json.size(), path, top_level_members);
 }
 
 json_parser_t::~json_parser_t()
@@ -8,6 +8,14 @@
 // https://github.com/Tencent/rapidjson/issues/1596#issuecomment-548774663
 #define RAPIDJSON_48BITPOINTER_OPTIMIZATION 0
 
+// Let the reader skip whitespace and scan strings 16 bytes at a time. Both instruction sets are
+// part of the baseline of their architectures, so no runtime check is needed.
+#if defined(_M_X64) || defined(__x86_64__)
+#define RAPIDJSON_SSE2
+#elif defined(__aarch64__)
+#define RAPIDJSON_NEON
+#endif
+
 // see https://github.com/Tencent/rapidjson/issues/1448
 // including windows.h on purpose to provoke a compile time problem as GetObject is a 
 // macro that gets defined when windows.h is included
@@ -34,10 +42,14 @@ class json_parser_t {
         using value_t = rapidjson::GenericValue<internal_encoding_type_t>;
         using document_t = rapidjson::GenericDocument<internal_encoding_type_t>;
 
+        using member_names_t = std::vector<pal::string_t>;
+
         const document_t& document() const { return m_document; }
 
-        bool parse_raw_data(char* data, int64_t size, const pal::string_t& context);
-        bool parse_file(const pal::string_t& path);
+        // If top_level_members is specified, only those members of the root object are materialized
+        // in the document; the values of all other members are validated but not stored.
+        bool parse_raw_data(char* data, int64_t size, const pal::string_t& context, const member_names_t* top_level_members = nullptr);
+        bool parse_file(const pal::string_t& path, const member_names_t* top_level_members = nullptr);
 
         json_parser_t()
             : m_bundle_data(nullptr)
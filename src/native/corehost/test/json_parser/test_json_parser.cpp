@@ -0,0 +1,149 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "json_parser.h"
+#include "pal.h"
+#include <cstring>
+
+#define TEST_ASSERT(a) \
+  if (!(a)) \
+  { \
+    fprintf(stderr, "TEST_ASSERT failed '%s' at %d\n", #a, __LINE__); \
+    exit(1); \
+  }
+
+namespace
+{
+    // Parses json with only the given root members materialized. The data is parsed in-situ,
+    // so it is copied into a buffer owned by the caller for as long as the document is used.
+    bool parse(json_parser_t& parser, std::vector<char>& buffer, const char* json, const json_parser_t::member_names_t& members)
+    {
+        size_t size = strlen(json);
+        buffer.assign(json, json + size + 1);
+        return parser.parse_raw_data(buffer.data(), static_cast<int64_t>(size), _X("test.json"), &members);
+    }
+
+    void test_skipped_containers()
+    {
+        const char* json =
+            "{"
+            "  \"a\": { \"x\": { \"y\": [ 1, { \"z\": [] } ] }, \"w\": [ [] ] },"
+            "  \"keep\": { \"k\": [ 1, 2 ], \"o\": { \"p\": \"q\" } },"
+            "  \"b\": [ [ 1, 2 ], [ { \"q\": {} } ], {} ],"
+            "  \"keep2\": \"v\""
+            "}";
+
+        json_parser_t parser;
+        std::vector<char> buffer;
+        TEST_ASSERT(parse(parser, buffer, json, { _X("keep"), _X("keep2") }));
+
+        const auto& doc = parser.document();
+        TEST_ASSERT(doc.IsObject());
+        TEST_ASSERT(doc.MemberCount() == 2);
+        TEST_ASSERT(!doc.HasMember(_X("a")));
+        TEST_ASSERT(!doc.HasMember(_X("b")));
+
+        // Members nested inside a kept member are all kept, whatever their names.
+        const auto& keep = doc[_X("keep")];
+        TEST_ASSERT(keep.IsObject());
+        TEST_ASSERT(keep.MemberCount() == 2);
+        TEST_ASSERT(keep[_X("k")].IsArray());
+        TEST_ASSERT(keep[_X("k")].Size() == 2);
+        TEST_ASSERT(keep[_X("k")][1].GetInt() == 2);
+        TEST_ASSERT(pal::string_t(keep[_X("o")][_X("p")].GetString()) == _X("q"));
+
+        TEST_ASSERT(pal::string_t(doc[_X("keep2")].GetString()) == _X("v"));
+    }
+
+    void test_skipped_scalars()
+    {
+        const char* json =
+            "{"
+            "  \"n\": null, \"t\": true, \"f\": false, \"i\": -1, \"u\": 4294967296,"
+            "  \"keep\": 7,"
+            "  \"d\": 1.5, \"s\": \"str\", \"e\": \"\""
+            "}";
+
+        json_parser_t parser;
+        std::vector<char> buffer;
+        TEST_ASSERT(parse(parser, buffer, json, { _X("keep") }));
+
+        const auto& doc = parser.document();
+        TEST_ASSERT(doc.MemberCount() == 1);
+        TEST_ASSERT(doc[_X("keep")].GetInt() == 7);
+    }
+
+    void test_member_count()
+    {
+        const char* json = "{ \"a\": 1, \"b\": [ 2 ], \"c\": { \"d\": 3 }, \"e\": 4 }";
+
+        // Requested members that are not in the document don't count.
+        {
+            json_parser_t parser;
+            std::vector<char> buffer;
+            TEST_ASSERT(parse(parser, buffer, json, { _X("b"), _X("e"), _X("missing") }));
+
+            const auto& doc = parser.document();
+            TEST_ASSERT(doc.MemberCount() == 2);
+            TEST_ASSERT(doc[_X("b")][0].GetInt() == 2);
+            TEST_ASSERT(doc[_X("e")].GetInt() == 4);
+
+            // Iterating must visit exactly the kept members.
+            size_t count = 0;
+            for (const auto& member : doc.GetObject())
+            {
+                (void)member;
+                count++;
+            }
+
+            TEST_ASSERT(count == 2);
+        }
+
+        // Nothing requested: an empty root object.
+        {
+            json_parser_t parser;
+            std::vector<char> buffer;
+            TEST_ASSERT(parse(parser, buffer, json, {}));
+            TEST_ASSERT(parser.document().IsObject());
+            TEST_ASSERT(parser.document().MemberCount() == 0);
+        }
+
+        // Everything requested: same as an unfiltered parse.
+        {
+            json_parser_t parser;
+            std::vector<char> buffer;
+            TEST_ASSERT(parse(parser, buffer, json, { _X("a"), _X("b"), _X("c"), _X("e") }));
+            TEST_ASSERT(parser.document().MemberCount() == 4);
+            TEST_ASSERT(parser.document()[_X("c")][_X("d")].GetInt() == 3);
+        }
+    }
+
+    void test_malformed_skipped_value()
+    {
+        const char* cases[] =
+        {
+            "{ \"skip\": { \"x\": [ 1, 2 }, \"keep\": 1 }",
+            "{ \"skip\": [ 1, 2, ], \"keep\": 1 }",
+            "{ \"skip\": tru, \"keep\": 1 }",
+            "{ \"skip\": \"unterminated, \"keep\": 1 }",
+            "{ \"keep\": 1, \"skip\": { \"x\": 1 ] }",
+        };
+
+        for (const char* json : cases)
+        {
+            json_parser_t parser;
+            std::vector<char> buffer;
+            TEST_ASSERT(!parse(parser, buffer, json, { _X("keep") }));
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    test_skipped_containers();
+    test_skipped_scalars();
+    test_member_count();
+    test_malformed_skipped_value();
+
+    return 0;
+}
@@ -212,6 +212,7 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_SysLog)
     DllImportEntry(SystemNative_WaitIdAnyExitedNoHangNoWait)
     DllImportEntry(SystemNative_WaitPidExitedNoHang)
+    DllImportEntry(SystemNative_OpenProcessExitHandle)
     DllImportEntry(SystemNative_PathConf)
     DllImportEntry(SystemNative_GetPriority)
     DllImportEntry(SystemNative_SetPriority)
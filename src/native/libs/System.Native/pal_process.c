@@ -33,6 +33,14 @@
 #include <mach-o/dyld.h>
 #endif
 
+#if defined(__linux__) && !defined(TARGET_ANDROID)
+#include <sys/syscall.h>
+// pidfd_open has the same number on every architecture; define it for builds against older headers.
+#ifndef __NR_pidfd_open
+#define __NR_pidfd_open 434
+#endif
+#endif
+
 #ifdef __FreeBSD__
 #include <sys/types.h>
 #include <sys/param.h>
@@ -742,6 +750,21 @@ int32_t SystemNative_WaitPidExitedNoHang(int32_t pid, int32_t* exitCode)
     return result;
 }
 
+int32_t SystemNative_OpenProcessExitHandle(int32_t pid)
+{
+#if defined(__linux__) && !defined(TARGET_ANDROID)
+    // The descriptor becomes readable once the process terminates, so it can be registered with the
+    // socket event port and lets the caller reap just this child instead of scanning every child on SIGCHLD.
+    // pidfd_open returns a close-on-exec descriptor. It doesn't block, so it never fails with EINTR.
+    // On kernels older than 5.3 this fails with ENOSYS.
+    return (int32_t)syscall(__NR_pidfd_open, pid, 0);
+#else
+    (void)pid;
+    errno = ENOTSUP;
+    return -1;
+#endif
+}
+
 int64_t SystemNative_PathConf(const char* path, PathConfName name)
 {
     int32_t confValue = -1;
@@ -196,6 +196,16 @@ PALEXPORT int32_t SystemNative_WaitIdAnyExitedNoHangNoWait(void);
  */
 PALEXPORT int32_t SystemNative_WaitPidExitedNoHang(int32_t pid, int32_t* exitCode);
 
+/**
+ * Opens a descriptor referring to the process with the given pid that becomes readable when the
+ * process terminates (Linux pidfd). Callers should open it before the child can be reaped, e.g.
+ * right after SystemNative_ForkAndExecProcess returns, so that the pid cannot have been reused.
+ *
+ * Returns the descriptor on success; otherwise, -1 is returned and errno is set (ENOTSUP on
+ * platforms without pidfd support, including Android).
+ */
+PALEXPORT int32_t SystemNative_OpenProcessExitHandle(int32_t pid);
+
 /**
  * Gets the configurable limit or variable for system path or file descriptor options.
  *
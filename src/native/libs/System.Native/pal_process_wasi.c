@@ -88,6 +88,12 @@ int32_t SystemNative_WaitPidExitedNoHang(int32_t pid, int32_t* exitCode)
     return -1;
 }
 
+int32_t SystemNative_OpenProcessExitHandle(int32_t pid)
+{
+    errno = ENOTSUP;
+    return -1;
+}
+
 int64_t SystemNative_PathConf(const char* path, PathConfName name)
 {
     return -1;
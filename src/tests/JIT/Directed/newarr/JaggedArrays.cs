@@ -0,0 +1,67 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using Xunit;
+
+// Allocating a jagged array with both dimensions (the runtime's T[][]::.ctor(int, int), reached
+// here through reflection) allocates all inner arrays at once. Enough inner arrays are requested
+// for the allocation to span several allocation context refills; each inner array must have the
+// right type and length, start zeroed, and not overlap any other.
+public class JaggedArrays
+{
+    private static readonly int[] s_innerLengths = { 0, 1, 3, 17, 100, 1000 };
+
+    private static T[][] NewJagged<T>(int outer, int inner)
+    {
+        return (T[][])Activator.CreateInstance(typeof(T[][]), outer, inner);
+    }
+
+    private static void Check<T>(int outer, int inner, Func<int, int, T> value)
+    {
+        T[][] a = NewJagged<T>(outer, inner);
+        Assert.Equal(outer, a.Length);
+
+        for (int i = 0; i < outer; i++)
+        {
+            Assert.NotNull(a[i]);
+            Assert.Equal(typeof(T[]), a[i].GetType());
+            Assert.Equal(inner, a[i].Length);
+            for (int j = 0; j < inner; j++)
+            {
+                Assert.Equal(default(T), a[i][j]);
+                a[i][j] = value(i, j);
+            }
+        }
+
+        // Make sure the heap is still walkable and the arrays survive a relocation.
+        GC.Collect();
+
+        for (int i = 0; i < outer; i++)
+        {
+            Assert.Equal(inner, a[i].Length);
+            for (int j = 0; j < inner; j++)
+            {
+                Assert.Equal(value(i, j), a[i][j]);
+            }
+        }
+    }
+
+    [Fact]
+    public static void TestEntryPoint()
+    {
+        foreach (int inner in s_innerLengths)
+        {
+            int outer = inner < 100 ? 20000 : 1000;
+
+            Check<byte>(outer, inner, (i, j) => (byte)(i + j));
+            Check<int>(outer, inner, (i, j) => i * 31 + j);
+            Check<long>(outer, inner, (i, j) => ((long)i << 32) | (uint)j);
+            Check<double>(outer, inner, (i, j) => i + j / 1024.0);
+            Check<string>(outer, inner, (i, j) => (j % 7 == 0) ? i.ToString() : null);
+        }
+
+        // A zero-length outer array has no inner arrays to allocate.
+        Assert.Empty(NewJagged<double>(0, 5));
+    }
+}
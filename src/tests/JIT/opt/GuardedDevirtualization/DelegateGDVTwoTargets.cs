@@ -0,0 +1,74 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Threading;
+using Xunit;
+
+// A delegate call site that sees two closed instance targets about equally often, plus a
+// rare third one. With JitGuardedDevirtualizationMaxDelegateChecks=2 the tier1 code guesses
+// both common targets; the rare one must still go through the fallback Invoke.
+public class DelegateGDVTwoTargets
+{
+    private sealed class Adder
+    {
+        private readonly int _value;
+
+        public Adder(int value) => _value = value;
+
+        public int Add(int x) => x + _value;
+
+        public int Mul(int x) => x * _value;
+
+        public int Sub(int x) => x - _value;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Invoke(Func<int, int> f, int x) => f(x);
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Run(Func<int, int> add, Func<int, int> mul, Func<int, int> sub)
+    {
+        int sum = 0;
+        for (int i = 0; i < 100; i++)
+        {
+            Func<int, int> f = (i % 50) == 49 ? sub : ((i & 1) == 0 ? add : mul);
+            sum += Invoke(f, i);
+        }
+        return sum;
+    }
+
+    [Fact]
+    public static void TestEntryPoint()
+    {
+        Adder adder = new Adder(3);
+        Func<int, int> add = adder.Add;
+        Func<int, int> mul = adder.Mul;
+        Func<int, int> sub = adder.Sub;
+
+        int expected = 0;
+        for (int i = 0; i < 100; i++)
+        {
+            expected += (i % 50) == 49 ? i - 3 : ((i & 1) == 0 ? i + 3 : i * 3);
+        }
+
+        // Run long enough for Invoke to be instrumented and then rejitted at tier1
+        // with the delegate profile.
+        for (int iter = 0; iter < 100; iter++)
+        {
+            Assert.Equal(expected, Run(add, mul, sub));
+            if ((iter % 10) == 9)
+            {
+                Thread.Sleep(50);
+            }
+        }
+
+        // A target the profile never saw.
+        Func<int, int> other = new Adder(5).Add;
+        Assert.Equal(12, Invoke(other, 7));
+        Assert.Equal(10, Invoke(add, 7));
+        Assert.Equal(21, Invoke(mul, 7));
+        Assert.Equal(4, Invoke(sub, 7));
+    }
+}
@@ -0,0 +1,230 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System.Runtime.CompilerServices;
+using Xunit;
+
+// A struct with more profitable physical promotion candidates than the per-struct limit
+// (PHYSICAL_PROMOTION_MAX_PROMOTIONS_PER_STRUCT, 64). Elements 0..63 are each accessed a few
+// times outside the loop; elements 64..71 are accessed in the loop. Ranking by benefit keeps
+// the loop elements promoted instead of the first 64 in offset order; either way the results
+// must match.
+public class PromotionManyCandidates
+{
+    [InlineArray(72)]
+    private struct Buffer72
+    {
+        private long _element;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static long Run(int n, long seed)
+    {
+        Buffer72 b = default;
+        b[0] = seed + 0;
+        b[1] = seed + 1;
+        b[2] = seed + 2;
+        b[3] = seed + 3;
+        b[4] = seed + 4;
+        b[5] = seed + 5;
+        b[6] = seed + 6;
+        b[7] = seed + 7;
+        b[8] = seed + 8;
+        b[9] = seed + 9;
+        b[10] = seed + 10;
+        b[11] = seed + 11;
+        b[12] = seed + 12;
+        b[13] = seed + 13;
+        b[14] = seed + 14;
+        b[15] = seed + 15;
+        b[16] = seed + 16;
+        b[17] = seed + 17;
+        b[18] = seed + 18;
+        b[19] = seed + 19;
+        b[20] = seed + 20;
+        b[21] = seed + 21;
+        b[22] = seed + 22;
+        b[23] = seed + 23;
+        b[24] = seed + 24;
+        b[25] = seed + 25;
+        b[26] = seed + 26;
+        b[27] = seed + 27;
+        b[28] = seed + 28;
+        b[29] = seed + 29;
+        b[30] = seed + 30;
+        b[31] = seed + 31;
+        b[32] = seed + 32;
+        b[33] = seed + 33;
+        b[34] = seed + 34;
+        b[35] = seed + 35;
+        b[36] = seed + 36;
+        b[37] = seed + 37;
+        b[38] = seed + 38;
+        b[39] = seed + 39;
+        b[40] = seed + 40;
+        b[41] = seed + 41;
+        b[42] = seed + 42;
+        b[43] = seed + 43;
+        b[44] = seed + 44;
+        b[45] = seed + 45;
+        b[46] = seed + 46;
+        b[47] = seed + 47;
+        b[48] = seed + 48;
+        b[49] = seed + 49;
+        b[50] = seed + 50;
+        b[51] = seed + 51;
+        b[52] = seed + 52;
+        b[53] = seed + 53;
+        b[54] = seed + 54;
+        b[55] = seed + 55;
+        b[56] = seed + 56;
+        b[57] = seed + 57;
+        b[58] = seed + 58;
+        b[59] = seed + 59;
+        b[60] = seed + 60;
+        b[61] = seed + 61;
+        b[62] = seed + 62;
+        b[63] = seed + 63;
+        b[64] = seed + 64;
+        b[65] = seed + 65;
+        b[66] = seed + 66;
+        b[67] = seed + 67;
+        b[68] = seed + 68;
+        b[69] = seed + 69;
+        b[70] = seed + 70;
+        b[71] = seed + 71;
+
+        long cold = 0;
+        cold += b[0] * 1;
+        cold += b[1] * 2;
+        cold += b[2] * 3;
+        cold += b[3] * 4;
+        cold += b[4] * 5;
+        cold += b[5] * 6;
+        cold += b[6] * 7;
+        cold += b[7] * 1;
+        cold += b[8] * 2;
+        cold += b[9] * 3;
+        cold += b[10] * 4;
+        cold += b[11] * 5;
+        cold += b[12] * 6;
+        cold += b[13] * 7;
+        cold += b[14] * 1;
+        cold += b[15] * 2;
+        cold += b[16] * 3;
+        cold += b[17] * 4;
+        cold += b[18] * 5;
+        cold += b[19] * 6;
+        cold += b[20] * 7;
+        cold += b[21] * 1;
+        cold += b[22] * 2;
+        cold += b[23] * 3;
+        cold += b[24] * 4;
+        cold += b[25] * 5;
+        cold += b[26] * 6;
+        cold += b[27] * 7;
+        cold += b[28] * 1;
+        cold += b[29] * 2;
+        cold += b[30] * 3;
+        cold += b[31] * 4;
+        cold += b[32] * 5;
+        cold += b[33] * 6;
+        cold += b[34] * 7;
+        cold += b[35] * 1;
+        cold += b[36] * 2;
+        cold += b[37] * 3;
+        cold += b[38] * 4;
+        cold += b[39] * 5;
+        cold += b[40] * 6;
+        cold += b[41] * 7;
+        cold += b[42] * 1;
+        cold += b[43] * 2;
+        cold += b[44] * 3;
+        cold += b[45] * 4;
+        cold += b[46] * 5;
+        cold += b[47] * 6;
+        cold += b[48] * 7;
+        cold += b[49] * 1;
+        cold += b[50] * 2;
+        cold += b[51] * 3;
+        cold += b[52] * 4;
+        cold += b[53] * 5;
+        cold += b[54] * 6;
+        cold += b[55] * 7;
+        cold += b[56] * 1;
+        cold += b[57] * 2;
+        cold += b[58] * 3;
+        cold += b[59] * 4;
+        cold += b[60] * 5;
+        cold += b[61] * 6;
+        cold += b[62] * 7;
+        cold += b[63] * 1;
+
+        for (int i = 0; i < n; i++)
+        {
+            b[64] = b[64] * 3 + i + 0;
+            b[65] = b[65] * 3 + i + 1;
+            b[66] = b[66] * 3 + i + 2;
+            b[67] = b[67] * 3 + i + 3;
+            b[68] = b[68] * 3 + i + 4;
+            b[69] = b[69] * 3 + i + 5;
+            b[70] = b[70] * 3 + i + 6;
+            b[71] = b[71] * 3 + i + 7;
+        }
+
+        long hot = 0;
+        hot ^= b[64];
+        hot ^= b[65];
+        hot ^= b[66];
+        hot ^= b[67];
+        hot ^= b[68];
+        hot ^= b[69];
+        hot ^= b[70];
+        hot ^= b[71];
+
+        return cold + hot;
+    }
+
+    private static long Reference(int n, long seed)
+    {
+        long[] b = new long[72];
+        for (int i = 0; i < b.Length; i++)
+        {
+            b[i] = seed + i;
+        }
+
+        long cold = 0;
+        for (int i = 0; i < 64; i++)
+        {
+            cold += b[i] * (i % 7 + 1);
+        }
+
+        for (int i = 0; i < n; i++)
+        {
+            for (int k = 0; k < 8; k++)
+            {
+                b[64 + k] = b[64 + k] * 3 + i + k;
+            }
+        }
+
+        long hot = 0;
+        for (int i = 64; i < 72; i++)
+        {
+            hot ^= b[i];
+        }
+
+        return cold + hot;
+    }
+
+    [Fact]
+    public static void TestEntryPoint()
+    {
+        // Run long enough for Run to be rejitted at tier1.
+        for (int iter = 0; iter < 200; iter++)
+        {
+            int n = iter % 50;
+            long seed = iter * 1000003L;
+            Assert.Equal(Reference(n, seed), Run(n, seed));
+        }
+    }
+}
@@ -0,0 +1,79 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System.Runtime.CompilerServices;
+using Xunit;
+
+// Equality chains where each test jumps to its own target. Dense chains with enough
+// distinct targets are turned into jump tables by switch recognition; sparse ones and
+// ones with too few targets must be left alone. Either way the results must match.
+public class SwitchRecognitionMultiTarget
+{
+    // Dense: 5 tests over [1..5], 5 distinct targets.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Dense(int x)
+    {
+        if (x == 1) return 10;
+        if (x == 2) return 20;
+        if (x == 3) return 30;
+        if (x == 4) return 40;
+        if (x == 5) return 50;
+        return -1;
+    }
+
+    // Dense with a repeated value: the first test of a value wins.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int DenseRepeated(int x)
+    {
+        if (x == 7) return 1;
+        if (x == 8) return 2;
+        if (x == 7) return 3;
+        if (x == 9) return 4;
+        if (x == 10) return 5;
+        return 0;
+    }
+
+    // Sparse: 3 tests spanning 63 values.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Sparse(int x)
+    {
+        if (x == 0) return 100;
+        if (x == 31) return 200;
+        if (x == 63) return 300;
+        return -1;
+    }
+
+    // Only two distinct targets.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int TwoTargets(int x)
+    {
+        if (x == 2) return 1;
+        if (x == 3) return 2;
+        if (x == 4) return 1;
+        return 0;
+    }
+
+    private static int DenseReference(int x) => (x >= 1 && x <= 5) ? x * 10 : -1;
+
+    private static int DenseRepeatedReference(int x) => x switch { 7 => 1, 8 => 2, 9 => 4, 10 => 5, _ => 0 };
+
+    private static int SparseReference(int x) => x switch { 0 => 100, 31 => 200, 63 => 300, _ => -1 };
+
+    private static int TwoTargetsReference(int x) => x switch { 2 => 1, 3 => 2, 4 => 1, _ => 0 };
+
+    [Fact]
+    public static void TestEntryPoint()
+    {
+        for (int x = -70; x <= 70; x++)
+        {
+            Assert.Equal(DenseReference(x), Dense(x));
+            Assert.Equal(DenseRepeatedReference(x), DenseRepeated(x));
+            Assert.Equal(SparseReference(x), Sparse(x));
+            Assert.Equal(TwoTargetsReference(x), TwoTargets(x));
+        }
+
+        Assert.Equal(-1, Dense(int.MinValue));
+        Assert.Equal(-1, Dense(int.MaxValue));
+        Assert.Equal(-1, Sparse(int.MaxValue));
+    }
+}
@@ -0,0 +1,109 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using Xunit;
+
+// Comparisons against 9..16 char constants are unrolled into two overlapping 16-byte loads.
+// Place the input right before a guard page so that any access past its end faults.
+public unsafe class StringEqualsPageBoundary
+{
+    private delegate bool Comparer(ReadOnlySpan<char> s);
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static bool Ordinal9(ReadOnlySpan<char> s) => s.SequenceEqual("abcdefghi");
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static bool Ordinal10(ReadOnlySpan<char> s) => s.SequenceEqual("abcdefghij");
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static bool Ordinal12(ReadOnlySpan<char> s) => s.SequenceEqual("abcdefghijkl");
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static bool Ordinal14(ReadOnlySpan<char> s) => s.SequenceEqual("abcdefghijklmn");
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static bool Ordinal16(ReadOnlySpan<char> s) => s.SequenceEqual("abcdefghijklmnop");
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static bool StartsWith10(ReadOnlySpan<char> s) => s.StartsWith("abcdefghij", StringComparison.Ordinal);
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static bool StartsWith12(ReadOnlySpan<char> s) => s.StartsWith("abcdefghijkl", StringComparison.Ordinal);
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static bool StartsWith14(ReadOnlySpan<char> s) => s.StartsWith("abcdefghijklmn", StringComparison.Ordinal);
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static bool IgnoreCase10(ReadOnlySpan<char> s) => s.Equals("AbCdEfGhIj", StringComparison.OrdinalIgnoreCase);
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static bool IgnoreCase12(ReadOnlySpan<char> s) => s.Equals("AbCdEfGhIjKl", StringComparison.OrdinalIgnoreCase);
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static bool IgnoreCase14(ReadOnlySpan<char> s) => s.Equals("AbCdEfGhIjKlMn", StringComparison.OrdinalIgnoreCase);
+
+    // Copies value so that it ends exactly at the guard page.
+    private static ReadOnlySpan<char> AtPageEnd(byte* page, nuint pageSize, string value)
+    {
+        char* dst = (char*)(page + pageSize) - value.Length;
+        value.AsSpan().CopyTo(new Span<char>(dst, value.Length));
+        return new ReadOnlySpan<char>(dst, value.Length);
+    }
+
+    private static void Check(byte* page, nuint pageSize, Comparer compare, string match, string ignoreCaseMatch)
+    {
+        Assert.True(compare(AtPageEnd(page, pageSize, match)));
+        if (ignoreCaseMatch != null)
+        {
+            Assert.True(compare(AtPageEnd(page, pageSize, ignoreCaseMatch)));
+        }
+
+        // A mismatch in the first and in the last char, and a shorter input.
+        Assert.False(compare(AtPageEnd(page, pageSize, "X" + match.Substring(1))));
+        Assert.False(compare(AtPageEnd(page, pageSize, match.Substring(0, match.Length - 1) + "X")));
+        Assert.False(compare(AtPageEnd(page, pageSize, match.Substring(1))));
+    }
+
+    [Fact]
+    public static void TestEntryPoint()
+    {
+        nuint pageSize = (nuint)Environment.SystemPageSize;
+        byte* page = CrossplatVirtualAlloc.AllocWithGuard(pageSize);
+        Assert.True(page != null);
+
+        try
+        {
+            // Run long enough for the methods to be rejitted at tier1.
+            for (int i = 0; i < 200; i++)
+            {
+                Check(page, pageSize, Ordinal9, "abcdefghi", null);
+                Check(page, pageSize, Ordinal10, "abcdefghij", null);
+                Check(page, pageSize, Ordinal12, "abcdefghijkl", null);
+                Check(page, pageSize, Ordinal14, "abcdefghijklmn", null);
+                Check(page, pageSize, Ordinal16, "abcdefghijklmnop", null);
+                Check(page, pageSize, StartsWith10, "abcdefghij", null);
+                Check(page, pageSize, StartsWith12, "abcdefghijkl", null);
+                Check(page, pageSize, StartsWith14, "abcdefghijklmn", null);
+                Check(page, pageSize, IgnoreCase10, "abcdefghij", "ABCDEFGHIJ");
+                Check(page, pageSize, IgnoreCase12, "abcdefghijkl", "ABCDEFGHIJKL");
+                Check(page, pageSize, IgnoreCase14, "abcdefghijklmn", "ABCDEFGHIJKLMN");
+            }
+        }
+        finally
+        {
+            CrossplatVirtualAlloc.Free(page, pageSize);
+        }
+    }
+}
+
+internal static unsafe class CrossplatVirtualAlloc
+{
+    [DllImport(nameof(CrossplatVirtualAlloc))]
+    public static extern byte* AllocWithGuard(nuint size);
+
+    [DllImport(nameof(CrossplatVirtualAlloc))]
+    public static extern void Free(byte* ptr, nuint size);
+}